@@ -2,6 +2,7 @@
 #include <string.h>
 #include <stdbool.h>
 #include <stdlib.h>
+#include <stdint.h>
 #include "graph.h"
 #include "queue.h" 
 #include "bfs.h"
@@ -18,6 +19,9 @@
  * in the order they are first discovered. Neighbor vertices are visited in
  * lexicographic order for consistent output.
  *
+ * All scratch space (visited flags, neighbor buffer) lives on the heap and is
+ * sized from the graph itself, so there is no fixed vertex limit.
+ *
  * Output:
  * - Prints the name of each visited vertex, one per line,
  * in the order they are discovered.
@@ -27,84 +31,116 @@
  * - startName: name of the starting vertex for BFS traversal
  */
 void bfs(Graph* g, const char* startName) {
-    // Step 1: Validate that the starting vertex exists in the graph.
-    // If not, the traversal cannot begin, so the function returns immediately.
-    if (!graph_vertex_exists(g, startName)) return;
+    // Step 1: Resolve the starting vertex to its id once.
+    // If it does not exist, the traversal cannot begin, so return immediately.
+    VertexId s = graph_vertex_id(g, startName);
+    if (s == GRAPH_NO_VERTEX) return;
 
     // Step 2: Initialize the queue data structure.
-    // This queue will hold the names of vertices that have been discovered but whose
-    // neighbors have not yet been explored.
+    // This queue will hold entries of the id-indexed name table for vertices
+    // that have been discovered but whose neighbors have not yet been
+    // explored. Names are borrowed from the graph, so nothing is copied or
+    // freed per vertex.
     Queue* q = queue_create(0); // Use the queue's default capacity.
     if (!q) return; // Exit if memory for the queue could not be allocated.
 
     // Step 3: Initialize a data structure to track visited vertices.
-    // A 2D char array stores the names of visited nodes to prevent cycles
-    // and ensure each vertex is processed only once.
-    char visited[MAX_VERTICES][MAX_NAME_LEN];
-    int visitedCount = 0;
+    // Vertices are indexed by their VertexId, and a heap-allocated flag array
+    // marks which ones have been discovered.
+    size_t n = graph_vertex_count(g);
+    const char** names = malloc(n * sizeof(const char*));
+    bool* visited = calloc(n, sizeof(bool));
+    if (!names || !visited) {
+        free(names); free(visited); queue_destroy(q);
+        return;
+    }
+    graph_get_names_by_id(g, names);
+
 
     // Step 4: Begin the traversal from the starting vertex.
-    // A copy of the start name is allocated because the queue will take ownership
-    // of the memory and free it later.
-    char* startCopy = strdup(startName);
-    queue_enqueue(q, startCopy);
-    strcpy(visited[visitedCount++], startName); // Mark the start vertex as visited.
-    printf("%s\n", startName);                  // Print the start vertex upon discovery.
+    visited[s] = true;                          // Mark the start vertex as visited.
+    queue_enqueue(q, (void*)&names[s]);
+    printf("%s\n", names[s]);                   // Print the start vertex upon discovery.
 
     // Step 5: Main traversal loop.
     // Continue processing vertices as long as the queue is not empty.
     while (!queue_is_empty(q)) {
-        // Dequeue the next vertex in the traversal order.
-        char* current = queue_dequeue(q);
-        if (!current) break; // Safety check in case of an empty queue.
+        // Dequeue the next vertex in the traversal order; its id is its
+        // position in the name table.
+        const char** entry = queue_dequeue(q);
+        if (!entry) break; // Safety check in case of an empty queue.
+        VertexId current = (VertexId)(entry - names);
 
-        // Retrieve all neighbors of the current vertex from the graph.
-        char neighbors[MAX_VERTICES][MAX_NAME_LEN];
-        int count = graph_get_neighbors(g, current, neighbors);
-        free(current); // The dequeued name is no longer needed; free its memory.
-
-        // --- Sort Neighbors for Deterministic Order ---
-        // To meet the lexicographical ordering requirement, this section sorts the
-        // retrieved neighbor names using a Bubble Sort algorithm before processing.
-        for (int i = 0; i < count - 1; ++i) {
-            for (int j = i + 1; j < count; ++j) {
-                if (strcmp(neighbors[i], neighbors[j]) > 0) {
-                    char tmp[MAX_NAME_LEN];
-                    strcpy(tmp, neighbors[i]);
-                    strcpy(neighbors[i], neighbors[j]);
-                    strcpy(neighbors[j], tmp);
-                }
-            }
-        }
+        // Walk the current vertex's neighbors in place. The graph keeps
+        // adjacency arrays sorted, so they already arrive in lexicographic
+        // order of the names; nothing is copied.
+        GraphNeighborIter it;
+        graph_neighbors_begin(g, current, &it);
 
         // Step 6: Iterate through the sorted neighbors.
-        for (int i = 0; i < count; ++i) {
-            // Check if the current neighbor has already been visited by searching
-            // the 'visited' array.
-            bool seen = false;
-            for (int j = 0; j < visitedCount; ++j) {
-                if (strcmp(visited[j], neighbors[i]) == 0) {
-                    seen = true;
-                    break;
-                }
-            }
+        for (const GraphNeighbor* nb; (nb = graph_neighbors_next(&it)); ) {
+            // Check if the current neighbor has already been visited.
+            VertexId v = nb->id;
+            if (visited[v]) continue;
 
-            // If the neighbor has not been visited yet:
-            if (!seen) {
-                // Mark the neighbor as visited.
-                strcpy(visited[visitedCount++], neighbors[i]);
-                // Allocate a new copy of the name to be enqueued.
-                char* nameCopy = strdup(neighbors[i]);
-                queue_enqueue(q, nameCopy);
-                // Print the neighbor's name upon discovery.
-                printf("%s\n", neighbors[i]);
-            }
+            // Mark the neighbor as visited, enqueue it, and print its name
+            // upon discovery.
+            visited[v] = true;
+            queue_enqueue(q, (void*)&names[v]);
+            printf("%s\n", names[v]);
         }
     }
 
     // Step 7: Clean up resources.
-    // The queue and all its remaining allocated strings are destroyed.
+    free(visited);
+    free(names);
     queue_destroy(q);
     // Print a final newline for correct output formatting as per the spec.
     putchar('\n');
-}
\ No newline at end of file
+}
+
+/*
+ * FUNCTION: bfs_csr
+ * -----------------
+ * BFS over a CSR snapshot, with output identical to bfs().
+ *
+ * Vertices are integer indices, so the FIFO is a flat index array (each
+ * vertex is enqueued at most once, so n slots suffice) and neighbor rows
+ * are read straight from the snapshot's contiguous arrays, already in
+ * lexicographic order.
+ *
+ * Parameters:
+ * - csr: snapshot produced by graph_freeze()
+ * - startName: name of the starting vertex for BFS traversal
+ */
+void bfs_csr(const GraphCSR* csr, const char* startName) {
+    // Step 1: Resolve the start vertex; print nothing if it does not exist.
+    long s = graph_csr_index_of(csr, startName);
+    if (s < 0) return;
+
+    // Step 2: Allocate the FIFO and visited flags.
+    uint32_t* fifo = malloc(csr->n * sizeof(uint32_t));
+    bool* visited = calloc(csr->n, sizeof(bool));
+    if (!fifo || !visited) { free(fifo); free(visited); return; }
+
+    // Step 3: Traverse level by level, printing vertices on discovery.
+    size_t head = 0, tail = 0;
+    fifo[tail++] = (uint32_t)s;
+    visited[s] = true;
+    printf("%s\n", csr->names[s]);
+    while (head < tail) {
+        uint32_t u = fifo[head++];
+        for (size_t k = csr->offsets[u]; k < csr->offsets[u + 1]; ++k) {
+            uint32_t v = csr->adj[k];
+            if (visited[v]) continue;
+            visited[v] = true;
+            fifo[tail++] = v;
+            printf("%s\n", csr->names[v]);
+        }
+    }
+
+    // Step 4: Clean up and print the final newline.
+    free(fifo);
+    free(visited);
+    putchar('\n');
+}
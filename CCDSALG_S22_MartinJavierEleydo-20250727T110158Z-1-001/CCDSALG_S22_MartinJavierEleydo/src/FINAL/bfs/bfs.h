@@ -14,6 +14,9 @@
 
 // Includes the definition for the Graph struct, which is a required
 // parameter for the bfs function.
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 #include "graph.h"
 
 /**
@@ -31,4 +34,88 @@
  */
 void bfs(Graph* g, const char* startName);
 
+/**
+ * @brief Performs the same BFS on a CSR snapshot of the graph.
+ *
+ * Output is identical to bfs(); traversal reads the snapshot's contiguous
+ * neighbor arrays instead of the graph's linked lists.
+ *
+ * @param csr A snapshot produced by graph_freeze().
+ * @param startName Name of the starting vertex (nothing is printed if absent).
+ */
+void bfs_csr(const GraphCSR* csr, const char* startName);
+
+/**
+ * @brief Computes the BFS visit order with a direction-optimizing search.
+ *
+ * Each level runs top-down or bottom-up, whichever scans fewer edges, over
+ * bitmap visited/frontier sets (bfs_diropt.c). The order is exactly the one
+ * bfs() prints.
+ *
+ * @param csr A snapshot produced by graph_freeze().
+ * @param source Snapshot index of the starting vertex.
+ * @param order Receives the visited vertices; needs csr->n slots.
+ * @param count Receives the number of vertices written to order.
+ * @return false if source is not a vertex or memory runs out.
+ */
+bool bfs_order_csr(const GraphCSR* csr, long source, uint32_t* order, size_t* count);
+
+/**
+ * @brief Command 5 through bfs_order_csr(); output identical to bfs().
+ *
+ * @param csr A snapshot produced by graph_freeze().
+ * @param startName Name of the starting vertex (nothing is printed if absent).
+ */
+void bfs_diropt_csr(const GraphCSR* csr, const char* startName);
+
+/**
+ * @brief Level-synchronous multithreaded BFS (bfs_parallel.c).
+ *
+ * Threads expand slices of each level into their own next-frontier Queue,
+ * claiming vertices with an atomic test-and-set on a visited bitmap; the
+ * queues are merged once per level.
+ *
+ * @param csr A snapshot produced by graph_freeze().
+ * @param source Snapshot index of the starting vertex.
+ * @param nthreads Worker count; <= 0 picks one per CPU (fewer on small graphs).
+ * @param sorted true: each level in exactly the order bfs() prints it;
+ *               false: levels are correct but their internal order is not.
+ * @param order Receives the visited vertices; needs csr->n slots.
+ * @param count Receives the number of vertices written to order.
+ * @return false if source is not a vertex or memory runs out.
+ */
+bool bfs_parallel_csr(const GraphCSR* csr, long source, int nthreads, bool sorted,
+                      uint32_t* order, size_t* count);
+
+/**
+ * @brief Command 5 through bfs_parallel_csr() in sorted mode; output
+ * identical to bfs().
+ *
+ * @param csr A snapshot produced by graph_freeze().
+ * @param startName Name of the starting vertex (nothing is printed if absent).
+ * @param nthreads Worker count; <= 0 picks one per CPU.
+ */
+void bfs_parallel_print_csr(const GraphCSR* csr, const char* startName, int nthreads);
+
+/**
+ * @brief Hop distance reported by bfs_multi_source_csr() for unreachable vertices.
+ */
+#define BFS_UNREACHED UINT32_MAX
+
+/**
+ * @brief Multi-source bit-parallel BFS (bfs_multi.c).
+ *
+ * Runs up to 256 traversals per walk of the adjacency, with one mask bit per
+ * source on every vertex, and returns hop distances (edge counts; weights
+ * are ignored).
+ *
+ * @param csr A snapshot produced by graph_freeze().
+ * @param sources Snapshot indices of the k sources (repeats are allowed).
+ * @param k Number of sources.
+ * @param dist Receives dist[i * csr->n + v], the hop distance from
+ *             sources[i] to v or BFS_UNREACHED; needs k * csr->n slots.
+ * @return false if a source is not a vertex or memory runs out.
+ */
+bool bfs_multi_source_csr(const GraphCSR* csr, const long* sources, size_t k, uint32_t* dist);
+
 #endif // BFS_H
\ No newline at end of file
@@ -0,0 +1,168 @@
+/*
+ * FILE: bfs_diropt.c
+ * ------------------
+ * Direction-optimizing BFS (Beamer-style top-down / bottom-up switching) on
+ * a CSR snapshot, with bitmap visited/frontier sets and the exact vertex
+ * order command 5 prints.
+ *
+ * Order:
+ *   - bfs() discovers level L+1 while scanning level L in order, so a vertex
+ *     is listed under its earliest level-L neighbor ("parent"), and the
+ *     vertices of one parent follow its adjacency row, i.e. ascending index.
+ *     Level L+1 is therefore sorted by (position of parent, index).
+ *
+ * Steps (per level):
+ *   - top-down : scan the frontier's rows in order and claim unvisited
+ *     neighbors. Cost: the frontier's edges (m_f).
+ *   - bottom-up: every unvisited vertex scans its own row for frontier
+ *     members (one bit test each) and keeps the earliest one; a stable
+ *     counting sort on that parent's position then restores the top-down
+ *     order. Cost: the unvisited vertices' edges (m_u). The earliest parent
+ *     is needed, so a row is only cut short when it meets the first frontier
+ *     vertex.
+ *   - Each level takes the cheaper direction (m_f > m_u: bottom-up). On
+ *     low-diameter graphs the middle levels hold most edges and go bottom-up.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "graph.h"
+#include "bfs.h"
+
+static bool bit_test(const uint64_t *bits, size_t i)
+{
+    return (bits[i >> 6] >> (i & 63)) & 1u;
+}
+
+static void bit_set(uint64_t *bits, size_t i)
+{
+    bits[i >> 6] |= (uint64_t)1 << (i & 63);
+}
+
+static size_t degree(const GraphCSR *csr, size_t v)
+{
+    return csr->offsets[v + 1] - csr->offsets[v];
+}
+
+/*
+ * Function: bfs_order_csr
+ * -----------------------
+ * Fills order[0 .. *count) with the vertices reachable from 'source' in the
+ * order bfs() prints them. 'order' needs csr->n slots. Returns false on a bad
+ * source or OOM.
+ */
+bool bfs_order_csr(const GraphCSR *csr, long source, uint32_t *order, size_t *count)
+{
+    if (count) *count = 0;
+    if (!csr || !order || !count || source < 0 || (size_t)source >= csr->n) return false;
+
+    // --- Step 1: Bitmaps, positions, and bottom-up scratch ---
+    size_t n = csr->n, words = (n + 63) / 64;
+    uint64_t *visited  = calloc(words, sizeof(uint64_t));
+    uint64_t *frontier = calloc(words, sizeof(uint64_t));
+    uint32_t *pos      = malloc(n * sizeof(uint32_t));  // Index of v in order[]
+    uint32_t *cand     = malloc(n * sizeof(uint32_t));  // Bottom-up finds, ascending
+    uint32_t *key      = malloc(n * sizeof(uint32_t));  // Their parent's rank in the level
+    size_t   *bucket   = malloc((n + 1) * sizeof(size_t));
+    if (!visited || !frontier || !pos || !cand || !key || !bucket) {
+        free(visited); free(frontier); free(pos); free(cand); free(key); free(bucket);
+        return false;
+    }
+
+    // --- Step 2: Level 0 ---
+    size_t head = 0, tail = 0;
+    order[tail] = (uint32_t)source;
+    pos[source] = (uint32_t)tail++;
+    bit_set(visited, (size_t)source);
+    size_t m_u = csr->m - degree(csr, (size_t)source);   // Edges of unvisited vertices
+    size_t m_f = degree(csr, (size_t)source);            // Edges of the frontier
+
+    // --- Step 3: One level per pass, in the cheaper direction ---
+    while (head < tail) {
+        size_t level_end = tail, next_m_f = 0;
+        if (m_f <= m_u) {
+            // Top-down: claim neighbors in frontier order
+            for (size_t i = head; i < level_end; i++) {
+                uint32_t u = order[i];
+                for (size_t k = csr->offsets[u]; k < csr->offsets[u + 1]; k++) {
+                    uint32_t v = csr->adj[k];
+                    if (bit_test(visited, v)) continue;
+                    bit_set(visited, v);
+                    pos[v] = (uint32_t)tail;
+                    order[tail++] = v;
+                    m_u -= degree(csr, v);
+                    next_m_f += degree(csr, v);
+                }
+            }
+        } else {
+            // Bottom-up: unvisited vertices look for their earliest parent
+            memset(frontier, 0, words * sizeof(uint64_t));
+            for (size_t i = head; i < level_end; i++) bit_set(frontier, order[i]);
+            size_t found = 0;
+            for (size_t w = 0; w < words; w++) {
+                if (visited[w] == UINT64_MAX) continue;
+                size_t hi = (w + 1) * 64 < n ? (w + 1) * 64 : n;
+                for (size_t v = w * 64; v < hi; v++) {
+                    if (bit_test(visited, v)) continue;
+                    uint32_t best = UINT32_MAX;
+                    for (size_t k = csr->offsets[v]; k < csr->offsets[v + 1]; k++) {
+                        uint32_t u = csr->adj[k];
+                        if (!bit_test(frontier, u) || pos[u] >= best) continue;
+                        best = pos[u];
+                        if (best == head) break;   // Level's first vertex: cannot do better
+                    }
+                    if (best == UINT32_MAX) continue;
+                    cand[found] = (uint32_t)v;
+                    key[found++] = best - (uint32_t)head;
+                }
+            }
+
+            // Stable counting sort by parent rank: top-down order
+            size_t width = level_end - head;
+            memset(bucket, 0, (width + 1) * sizeof(size_t));
+            for (size_t j = 0; j < found; j++) bucket[key[j] + 1]++;
+            for (size_t r = 0; r < width; r++) bucket[r + 1] += bucket[r];
+            for (size_t j = 0; j < found; j++) order[tail + bucket[key[j]]++] = cand[j];
+            for (size_t j = 0; j < found; j++) {
+                uint32_t v = order[tail + j];
+                bit_set(visited, v);
+                pos[v] = (uint32_t)(tail + j);
+                m_u -= degree(csr, v);
+                next_m_f += degree(csr, v);
+            }
+            tail += found;
+        }
+        head = level_end;
+        m_f = next_m_f;
+    }
+
+    free(visited); free(frontier); free(pos); free(cand); free(key); free(bucket);
+    *count = tail;
+    return true;
+}
+
+/*
+ * FUNCTION: bfs_diropt_csr
+ * ------------------------
+ * Command 5 through bfs_order_csr; output identical to bfs(). Falls back to
+ * bfs_csr() if the scratch arrays cannot be allocated.
+ */
+void bfs_diropt_csr(const GraphCSR* csr, const char* startName)
+{
+    long s = graph_csr_index_of(csr, startName);
+    if (s < 0) return;
+
+    size_t count = 0;
+    uint32_t *order = malloc(csr->n * sizeof(uint32_t));
+    if (!order || !bfs_order_csr(csr, s, order, &count)) {
+        free(order);
+        bfs_csr(csr, startName);
+        return;
+    }
+    for (size_t i = 0; i < count; i++) printf("%s\n", csr->names[order[i]]);
+    free(order);
+    putchar('\n');
+}
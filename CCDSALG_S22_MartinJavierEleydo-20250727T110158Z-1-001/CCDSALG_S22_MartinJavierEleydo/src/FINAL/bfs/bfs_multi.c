@@ -0,0 +1,127 @@
+/*
+ * FILE: bfs_multi.c
+ * -----------------
+ * Multi-source bit-parallel BFS (MS-BFS, Then et al.) on a CSR snapshot:
+ * hop distances from many sources, with one walk of the adjacency shared by
+ * up to MSBFS_BATCH of them.
+ *
+ * Each vertex carries bit masks with one bit per source of the batch:
+ *   - seen[v]  : sources that have reached v
+ *   - visit[v] : sources whose frontier contains v this level
+ *   - next[v]  : sources reaching v next level (before removing seen ones)
+ * One level ORs visit[v] into next[u] for every edge v-u, then keeps
+ * next[u] & ~seen[u] as u's new frontier bits and records the level as the
+ * distance for each of those sources. Every edge is read once per level for
+ * the whole batch instead of once per source.
+ *
+ * A batch uses as many 64-bit words per mask as it needs (1..4, so up to 256
+ * sources); the word loops are short fixed-trip loops the compiler can
+ * vectorize. Larger source lists run in consecutive batches.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "graph.h"
+#include "bfs.h"
+
+#define MSBFS_WORDS 4                     // Mask words per vertex, at most
+#define MSBFS_BATCH (64 * MSBFS_WORDS)    // Sources per pass
+
+// Index of the lowest set bit of a non-zero word.
+static unsigned lowest_bit(uint64_t x)
+{
+#if defined(__GNUC__)
+    return (unsigned)__builtin_ctzll(x);
+#else
+    unsigned i = 0;
+    while (!(x & 1u)) { x >>= 1; i++; }
+    return i;
+#endif
+}
+
+// One batch: sources[0 .. k), k <= MSBFS_BATCH, words = ceil(k / 64).
+static void msbfs_batch(const GraphCSR *csr, const long *sources, size_t k, size_t words,
+                        uint64_t *seen, uint64_t *visit, uint64_t *next, uint32_t *dist)
+{
+    size_t n = csr->n;
+    memset(seen, 0, n * words * sizeof(uint64_t));
+    memset(visit, 0, n * words * sizeof(uint64_t));
+    memset(next, 0, n * words * sizeof(uint64_t));
+
+    // --- Level 0: each source sees itself ---
+    for (size_t i = 0; i < k; i++) {
+        size_t s = (size_t)sources[i];
+        uint64_t bit = (uint64_t)1 << (i & 63);
+        seen[s * words + i / 64] |= bit;
+        visit[s * words + i / 64] |= bit;
+        dist[i * n + s] = 0;
+    }
+
+    // --- One level per pass while any source still has a frontier ---
+    for (uint32_t level = 1; ; level++) {
+        for (size_t v = 0; v < n; v++) {
+            const uint64_t *mv = &visit[v * words];
+            uint64_t any = 0;
+            for (size_t j = 0; j < words; j++) any |= mv[j];
+            if (!any) continue;
+            for (size_t e = csr->offsets[v]; e < csr->offsets[v + 1]; e++) {
+                uint64_t *mu = &next[(size_t)csr->adj[e] * words];
+                for (size_t j = 0; j < words; j++) mu[j] |= mv[j];
+            }
+        }
+
+        bool active = false;
+        for (size_t u = 0; u < n; u++) {
+            uint64_t *mu = &next[u * words], *su = &seen[u * words], *vu = &visit[u * words];
+            for (size_t j = 0; j < words; j++) {
+                uint64_t fresh = mu[j] & ~su[j];
+                mu[j] = 0;
+                vu[j] = fresh;
+                if (!fresh) continue;
+                su[j] |= fresh;
+                active = true;
+                for (uint64_t b = fresh; b; b &= b - 1)
+                    dist[(j * 64 + lowest_bit(b)) * n + u] = level;
+            }
+        }
+        if (!active) break;
+    }
+}
+
+/*
+ * Function: bfs_multi_source_csr
+ * ------------------------------
+ * Hop distances from each of sources[0 .. k): dist[i * csr->n + v] is the
+ * number of edges on a shortest path sources[i] -> v, or BFS_UNREACHED.
+ * 'dist' needs k * csr->n slots. Returns false on a bad source or OOM.
+ */
+bool bfs_multi_source_csr(const GraphCSR *csr, const long *sources, size_t k, uint32_t *dist)
+{
+    if (!csr || (k && (!sources || !dist))) return false;
+    size_t n = csr->n;
+    for (size_t i = 0; i < k; i++)
+        if (sources[i] < 0 || (size_t)sources[i] >= n) return false;
+    if (k == 0 || n == 0) return true;
+
+    size_t words = (k < MSBFS_BATCH ? k + 63 : MSBFS_BATCH) / 64;
+    uint64_t *seen  = malloc(n * words * sizeof(uint64_t));
+    uint64_t *visit = malloc(n * words * sizeof(uint64_t));
+    uint64_t *next  = malloc(n * words * sizeof(uint64_t));
+    if (!seen || !visit || !next) {
+        free(seen); free(visit); free(next);
+        return false;
+    }
+    for (size_t i = 0; i < k * n; i++) dist[i] = BFS_UNREACHED;
+
+    for (size_t first = 0; first < k; first += MSBFS_BATCH) {
+        size_t batch = k - first < MSBFS_BATCH ? k - first : MSBFS_BATCH;
+        msbfs_batch(csr, sources + first, batch, (batch + 63) / 64,
+                    seen, visit, next, dist + first * n);
+    }
+
+    free(seen); free(visit); free(next);
+    return true;
+}
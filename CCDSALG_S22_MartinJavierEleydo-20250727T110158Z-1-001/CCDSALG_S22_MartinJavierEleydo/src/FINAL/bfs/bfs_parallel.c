@@ -0,0 +1,255 @@
+/*
+ * FILE: bfs_parallel.c
+ * --------------------
+ * Level-synchronous multithreaded BFS on a CSR snapshot (pthreads).
+ *
+ * Per level:
+ *   1. expand: the frontier is split into one slice per thread. A thread
+ *      claims each unvisited neighbor with an atomic test-and-set on the
+ *      visited bitmap and appends it to its own next-frontier Queue
+ *      (queue.c; entries are &csr->names[v], as in bfs()).
+ *   2. merge : the queue sizes are prefix-summed and every thread drains its
+ *      queue into its range of order[], so the next frontier is contiguous.
+ *   3. sorted mode only: which thread claims a vertex depends on timing, so
+ *      the level is re-ordered the way bfs() emits it. Every new vertex
+ *      finds its earliest frontier neighbor (parallel), new vertices are
+ *      listed in ascending index from a bitmap, and a stable counting sort on
+ *      the parent's position gives (parent position, index) order.
+ *
+ * Without sorting, each level holds the right vertices in an unspecified
+ * order. A worker pool (worker_pool.c) lives for one run; phases on fewer
+ * than BFS_PAR_MIN_SLICE vertices run on the calling thread alone.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#include "graph.h"
+#include "queue.h"
+#include "worker_pool.h"
+#include "bfs.h"
+
+#define BFS_PAR_MIN_WORK    (1u << 15)   // Adjacency entries per thread (default count)
+#define BFS_PAR_MIN_SLICE   1024         // Shorter vertex lists skip the pool
+
+typedef enum BFSJob { BFS_EXPAND, BFS_MERGE, BFS_PARENT } BFSJob;
+
+// State shared by all threads of one run.
+typedef struct BFSRun {
+    const GraphCSR   *csr;
+    _Atomic uint64_t *visited;
+    _Atomic uint64_t *fresh;      // Sorted mode: vertices found this level
+    uint32_t         *order;
+    uint32_t         *pos;        // Index in order[] (UINT32_MAX: not placed yet)
+    uint32_t         *parent_pos; // Sorted mode: earliest frontier neighbor's pos
+    size_t            head, level_end, tail;
+    bool              sorted;
+    int               nthreads;
+    Queue            *next[WORKER_POOL_MAX_THREADS];
+    size_t            base[WORKER_POOL_MAX_THREADS];  // Merge: where queue t starts
+    atomic_bool       oom;
+} BFSRun;
+
+// --- Phase 1: claim unvisited neighbors of frontier[lo, hi) ---
+static void expand_slice(BFSRun *r, int t, size_t lo, size_t hi)
+{
+    const GraphCSR *csr = r->csr;
+    for (size_t i = lo; i < hi; i++) {
+        uint32_t u = r->order[i];
+        for (size_t k = csr->offsets[u]; k < csr->offsets[u + 1]; k++) {
+            uint32_t v = csr->adj[k];
+            uint64_t bit = (uint64_t)1 << (v & 63);
+            if (atomic_load_explicit(&r->visited[v >> 6], memory_order_relaxed) & bit) continue;
+            if (atomic_fetch_or_explicit(&r->visited[v >> 6], bit, memory_order_relaxed) & bit)
+                continue;   // Another thread claimed it first
+            if (r->sorted)
+                atomic_fetch_or_explicit(&r->fresh[v >> 6], bit, memory_order_relaxed);
+            if (!queue_enqueue(r->next[t], (void *)&csr->names[v]))
+                atomic_store_explicit(&r->oom, true, memory_order_relaxed);
+        }
+    }
+}
+
+// --- Phase 2: drain queue t into order[base[t] ...] ---
+static void merge_queue(BFSRun *r, int t)
+{
+    size_t at = r->base[t];
+    while (!queue_is_empty(r->next[t])) {
+        const char **entry = queue_dequeue(r->next[t]);
+        r->order[at++] = (uint32_t)(entry - r->csr->names);
+    }
+}
+
+// --- Phase 3 (sorted): earliest frontier neighbor of new vertices [lo, hi) ---
+static void parent_slice(BFSRun *r, size_t lo, size_t hi)
+{
+    const GraphCSR *csr = r->csr;
+    for (size_t i = lo; i < hi; i++) {
+        uint32_t v = r->order[i], best = UINT32_MAX;
+        for (size_t k = csr->offsets[v]; k < csr->offsets[v + 1]; k++) {
+            uint32_t p = r->pos[csr->adj[k]];
+            if (p >= r->head && p < r->level_end && p < best) best = p;
+        }
+        r->parent_pos[v] = best;
+    }
+}
+
+// Slice t of 'parts' of the current phase (WorkerSliceFn).
+static void run_slice(void *ctx, int job, int t, int parts)
+{
+    BFSRun *r = ctx;
+    if (job == BFS_MERGE) {
+        for (int q = t; q < r->nthreads; q += parts) merge_queue(r, q);
+        return;
+    }
+    size_t lo = (job == BFS_EXPAND) ? r->head : r->level_end;
+    size_t len = ((job == BFS_EXPAND) ? r->level_end : r->tail) - lo;
+    size_t a = lo + len * (size_t)t / (size_t)parts;
+    size_t b = lo + len * (size_t)(t + 1) / (size_t)parts;
+    if (job == BFS_EXPAND) expand_slice(r, t, a, b);
+    else                   parent_slice(r, a, b);
+}
+
+/*
+ * Helper: sort_level
+ * ------------------
+ * Sorted mode: rewrite order[level_end, tail) in bfs() order. 'scratch'
+ * holds the ascending list; 'bucket' the counting-sort offsets.
+ */
+static void sort_level(BFSRun *r, uint32_t *scratch, size_t *bucket)
+{
+    size_t n = r->csr->n, words = (n + 63) / 64, found = 0;
+    for (size_t w = 0; w < words; w++) {
+        uint64_t bits = atomic_load_explicit(&r->fresh[w], memory_order_relaxed);
+        if (!bits) continue;
+        atomic_store_explicit(&r->fresh[w], 0, memory_order_relaxed);
+        for (size_t b = 0; b < 64; b++)
+            if ((bits >> b) & 1u) scratch[found++] = (uint32_t)(w * 64 + b);
+    }
+    size_t width = r->level_end - r->head;
+    memset(bucket, 0, (width + 1) * sizeof(size_t));
+    for (size_t j = 0; j < found; j++) bucket[r->parent_pos[scratch[j]] - r->head + 1]++;
+    for (size_t k = 0; k < width; k++) bucket[k + 1] += bucket[k];
+    for (size_t j = 0; j < found; j++) {
+        uint32_t v = scratch[j];
+        r->order[r->level_end + bucket[r->parent_pos[v] - r->head]++] = v;
+    }
+}
+
+/*
+ * Function: bfs_parallel_csr
+ * --------------------------
+ * Level-synchronous BFS from 'source' on 'nthreads' threads (<= 0: one per
+ * CPU, fewer on small graphs). Fills order[0 .. *count) (csr->n slots) with
+ * the reachable vertices level by level; with 'sorted', in exactly the order
+ * bfs() prints. Returns false on a bad source or OOM.
+ */
+bool bfs_parallel_csr(const GraphCSR *csr, long source, int nthreads, bool sorted,
+                      uint32_t *order, size_t *count)
+{
+    if (count) *count = 0;
+    if (!csr || !order || !count || source < 0 || (size_t)source >= csr->n) return false;
+
+    // --- Thread count and allocation ---
+    nthreads = worker_pool_threads(nthreads, csr->m, BFS_PAR_MIN_WORK);
+    size_t n = csr->n, words = (n + 63) / 64;
+    BFSRun r;
+    memset(&r, 0, sizeof r);
+    r.csr = csr;
+    r.order = order;
+    r.sorted = sorted;
+    r.nthreads = nthreads;
+    r.visited = malloc(words * sizeof(_Atomic uint64_t));
+    uint32_t *scratch = NULL;
+    size_t *bucket = NULL;
+    bool ok = r.visited != NULL;
+    if (sorted) {
+        r.fresh      = malloc(words * sizeof(_Atomic uint64_t));
+        r.pos        = malloc(n * sizeof(uint32_t));
+        r.parent_pos = malloc(n * sizeof(uint32_t));
+        scratch      = malloc(n * sizeof(uint32_t));
+        bucket       = malloc((n + 1) * sizeof(size_t));
+        ok = ok && r.fresh && r.pos && r.parent_pos && scratch && bucket;
+    }
+    for (int t = 0; ok && t < nthreads; t++) ok = (r.next[t] = queue_create(0)) != NULL;
+    if (ok) {
+        for (size_t w = 0; w < words; w++) {
+            atomic_init(&r.visited[w], 0);
+            if (sorted) atomic_init(&r.fresh[w], 0);
+        }
+        if (sorted)
+            for (size_t v = 0; v < n; v++) r.pos[v] = UINT32_MAX;
+        atomic_init(&r.oom, false);
+    }
+
+    // --- Pool ---
+    WorkerPool *pool = ok ? worker_pool_create(nthreads, run_slice, &r) : NULL;
+    ok = pool != NULL;
+
+    // --- Level 0, then one level per pass ---
+    if (ok) {
+        order[0] = (uint32_t)source;
+        atomic_store(&r.visited[(size_t)source >> 6], (uint64_t)1 << (source & 63));
+        if (sorted) r.pos[source] = 0;
+        r.tail = 1;
+    }
+    while (ok && r.head < r.tail) {
+        r.level_end = r.tail;
+        worker_pool_run(pool, BFS_EXPAND, r.level_end - r.head, BFS_PAR_MIN_SLICE);
+        ok = !atomic_load(&r.oom);
+
+        size_t next_len = 0;
+        for (int t = 0; t < nthreads; t++) {
+            r.base[t] = r.level_end + next_len;
+            next_len += queue_size(r.next[t]);
+        }
+        worker_pool_run(pool, BFS_MERGE, next_len, BFS_PAR_MIN_SLICE);
+        r.tail = r.level_end + next_len;
+
+        if (ok && sorted && next_len > 0) {
+            worker_pool_run(pool, BFS_PARENT, next_len, BFS_PAR_MIN_SLICE);
+            sort_level(&r, scratch, bucket);
+            for (size_t i = r.level_end; i < r.tail; i++) r.pos[order[i]] = (uint32_t)i;
+        }
+        r.head = r.level_end;
+    }
+    worker_pool_destroy(pool);
+
+    for (int t = 0; t < nthreads; t++) queue_destroy(r.next[t]);
+    free((void *)r.visited);
+    free((void *)r.fresh);
+    free(r.pos);
+    free(r.parent_pos);
+    free(scratch);
+    free(bucket);
+    if (!ok) return false;
+    *count = r.tail;
+    return true;
+}
+
+/*
+ * FUNCTION: bfs_parallel_print_csr
+ * --------------------------------
+ * Command 5 through bfs_parallel_csr in sorted mode; output identical to
+ * bfs(). Falls back to bfs_diropt_csr() on OOM.
+ */
+void bfs_parallel_print_csr(const GraphCSR* csr, const char* startName, int nthreads)
+{
+    long s = graph_csr_index_of(csr, startName);
+    if (s < 0) return;
+
+    size_t count = 0;
+    uint32_t *order = malloc(csr->n * sizeof(uint32_t));
+    if (!order || !bfs_parallel_csr(csr, s, nthreads, true, order, &count)) {
+        free(order);
+        bfs_diropt_csr(csr, startName);
+        return;
+    }
+    for (size_t i = 0; i < count; i++) printf("%s\n", csr->names[order[i]]);
+    free(order);
+    putchar('\n');
+}
@@ -0,0 +1,854 @@
+// ============================================================================
+// FILE: contraction.c  – Contraction hierarchies (CH) index and queries
+// ----------------------------------------------------------------------------
+// Preprocessing (ch_build):
+//   - Vertices are contracted one at a time in order of priority
+//       shortcuts needed − current degree + contracted neighbours
+//     with lazy updates: a popped vertex is re-scored and pushed back if it
+//     is no longer the cheapest.
+//   - Contracting v joins every pair of its remaining neighbours (a, c) with
+//     a shortcut of weight w(a,v) + w(v,c), unless a witness search (bounded
+//     Dijkstra from a that avoids v) finds a path at least as short. Giving up
+//     early only adds a redundant shortcut, never a wrong distance.
+//   - v's remaining edges at that moment all lead to higher-ranked vertices;
+//     they become v's row of the upward graph (stored once, CSR layout). A
+//     shortcut keeps the vertex it bypasses (up_mid) so it can be unpacked.
+//
+// Query (ch_query):
+//   - Bidirectional upward search from s and t; each side stops once its
+//     queue key reaches the best meeting sum, so d(s, t) costs two pruned
+//     upward spaces. The s-t path through the meeting vertex is unpacked
+//     into original edges by splitting shortcuts at their middle vertex.
+//   - That path is a shortest one, but on weight ties not necessarily the one
+//     the single-source engines print. Their parent rule picks, for v, the
+//     neighbour u with d(s,u) + w(u,v) == d(s,v) on the heaviest such edge,
+//     ties to the greater index, so the printed path is rebuilt from t with
+//     that rule. The unpacked path supplies one tight predecessor per step,
+//     and only edges ranking before it in the rule need d(s, u): exact_dist
+//     over the forward search's upward space, memoised per query.
+//   - Cost on a vertex of degree D: one pass over its D entries without
+//     sorting, plus one memoised exact_dist per entry that ranks before the
+//     known tight edge (heavier, or as heavy to a greater index). That is up
+//     to D - 1 on a hub whose known edge is its lightest, none when the known
+//     edge already ranks first.
+//
+// Index file (ch_save / ch_load), native byte order:
+//   CHFileHeader, rank[n] (uint32), up_off[n+1] (uint64), up_adj[m_up]
+//   (uint32), up_w[m_up] (int32), up_mid[m_up] (uint32). The header carries
+//   the snapshot's n, m and an FNV-1a fingerprint of its offsets/adj/weights.
+// ============================================================================
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "graph.h"
+#include "heap.h"
+#include "shortest_Path.h"
+#include "contraction.h"
+
+#define INF SP_INF
+
+#define CH_WITNESS_SETTLE_LIMIT 64        // Vertices settled per witness search
+#define CH_FILE_MAGIC   "MCO2CHX"         // 7 chars + NUL = 8 bytes
+#define CH_FILE_VERSION 2u                // 2: shortcut middles (up_mid)
+#define CH_FILE_ENDIAN  0x01020304u
+#define CH_NO_MID       UINT32_MAX        // up_mid of an original edge
+
+// ============================================================================
+// INDEX
+// ============================================================================
+
+// One side of the upward search (labels valid where stamp == epoch).
+typedef struct CHSearch {
+    uint32_t    *stamp, epoch;
+    int         *dist;
+    uint32_t    *parent;    // Vertex the label came from
+    size_t      *via;       //   through this upward edge (SIZE_MAX: the root)
+    IndexedHeap *pq;
+} CHSearch;
+
+struct CHIndex {
+    const GraphCSR *csr;       // Snapshot the index answers for (borrowed)
+    size_t          n;
+    size_t          m_up;      // Upward edges
+    uint64_t        fingerprint;
+    uint32_t       *rank;      // Contraction position of every vertex
+    size_t         *up_off;    // Upward graph: row offsets (n + 1)
+    uint32_t       *up_adj;    //   higher-ranked neighbour
+    int            *up_w;      //   edge or shortcut weight
+    uint32_t       *up_mid;    //   vertex a shortcut bypasses (CH_NO_MID: original)
+
+    // --- Query scratch (labels valid where stamp == epoch) ---
+    CHSearch        fwd, bwd;           // Upward searches from source and target
+    uint32_t       *stamp_x, epoch_x;   // exact_dist memo
+    int            *dist_x;
+    size_t         *via_x;              //   winning upward edge (SIZE_MAX: up_s)
+    char           *state_x;            //   1 = expanding, 2 = done
+    uint32_t       *stack;              //   explicit DFS stack
+    size_t          stack_cap;
+};
+
+// FNV-1a over a byte range, continuing from 'h'.
+static uint64_t fnv1a(uint64_t h, const void *data, size_t len)
+{
+    const unsigned char *p = data;
+    for (size_t i = 0; i < len; i++) {
+        h ^= p[i];
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+// Fingerprint of a snapshot's structure (counts, offsets, neighbours, weights).
+static uint64_t csr_fingerprint(const GraphCSR *csr)
+{
+    uint64_t h = 14695981039346656037ull;
+    uint64_t counts[2] = { csr->n, csr->m };
+    h = fnv1a(h, counts, sizeof counts);
+    for (size_t i = 0; i <= csr->n; i++) {
+        uint64_t off = csr->offsets[i];
+        h = fnv1a(h, &off, sizeof off);
+    }
+    h = fnv1a(h, csr->adj, csr->m * sizeof(uint32_t));
+    for (size_t k = 0; k < csr->m; k++) {
+        int32_t w = csr->weights[k];
+        h = fnv1a(h, &w, sizeof w);
+    }
+    return h;
+}
+
+// Allocate one search side for n vertices. False on OOM.
+static bool search_alloc(CHSearch *S, size_t n)
+{
+    size_t cap = n ? n : 1;
+    S->stamp  = calloc(cap, sizeof(uint32_t));
+    S->dist   = malloc(cap * sizeof(int));
+    S->parent = malloc(cap * sizeof(uint32_t));
+    S->via    = malloc(cap * sizeof(size_t));
+    S->pq     = iheap_create(n);
+    return S->stamp && S->dist && S->parent && S->via && S->pq;
+}
+
+static void search_free(CHSearch *S)
+{
+    free(S->stamp);
+    free(S->dist);
+    free(S->parent);
+    free(S->via);
+    iheap_destroy(S->pq);
+}
+
+// Allocate an empty index with query scratch for n vertices.
+static CHIndex *index_alloc(const GraphCSR *csr)
+{
+    size_t n = csr->n, cap = n ? n : 1;
+    CHIndex *ch = calloc(1, sizeof *ch);
+    if (!ch) return NULL;
+    ch->csr = csr;
+    ch->n = n;
+    ch->rank    = malloc(cap * sizeof(uint32_t));
+    ch->up_off  = calloc(n + 1, sizeof(size_t));
+    ch->stamp_x = calloc(cap, sizeof(uint32_t));
+    ch->dist_x  = malloc(cap * sizeof(int));
+    ch->via_x   = malloc(cap * sizeof(size_t));
+    ch->state_x = malloc(cap);
+    bool ok = search_alloc(&ch->fwd, n) && search_alloc(&ch->bwd, n);
+    if (!ok || !ch->rank || !ch->up_off || !ch->stamp_x || !ch->dist_x ||
+        !ch->via_x || !ch->state_x) {
+        ch_destroy(ch);
+        return NULL;
+    }
+    return ch;
+}
+
+void ch_destroy(CHIndex *ch)
+{
+    if (!ch) return;
+    free(ch->rank);
+    free(ch->up_off);
+    free(ch->up_adj);
+    free(ch->up_w);
+    free(ch->up_mid);
+    search_free(&ch->fwd);
+    search_free(&ch->bwd);
+    free(ch->stamp_x);
+    free(ch->dist_x);
+    free(ch->via_x);
+    free(ch->state_x);
+    free(ch->stack);
+    free(ch);
+}
+
+size_t ch_edge_count(const CHIndex *ch) { return ch ? ch->m_up : 0; }
+
+// ============================================================================
+// PREPROCESSING
+// ============================================================================
+typedef struct CHEdge {
+    uint32_t to;
+    int      w;
+    uint32_t mid;   // Bypassed vertex of a shortcut (CH_NO_MID: original edge)
+} CHEdge;
+
+typedef struct CHList {
+    CHEdge  *e;
+    uint32_t len, cap;
+} CHList;
+
+typedef struct CHBuild {
+    size_t       n;
+    CHList      *rem;       // Remaining graph: edges between uncontracted vertices
+    CHList      *up;        // Row of each contracted vertex in the upward graph
+    int         *deleted;   // Contracted neighbours so far
+    uint32_t    *wstamp, wepoch;
+    int         *wdist;     // Witness search labels
+    IndexedHeap *wpq;
+} CHBuild;
+
+// Append edge -> to. False on OOM.
+static bool list_push(CHList *l, uint32_t to, int w, uint32_t mid)
+{
+    if (l->len == l->cap) {
+        uint32_t cap = l->cap ? 2 * l->cap : 4;
+        CHEdge *grown = realloc(l->e, cap * sizeof(CHEdge));
+        if (!grown) return false;
+        l->e = grown;
+        l->cap = cap;
+    }
+    l->e[l->len++] = (CHEdge){ to, w, mid };
+    return true;
+}
+
+// Add edge -> to with weight w, or lower an existing one. False on OOM.
+static bool list_set_min(CHList *l, uint32_t to, int w, uint32_t mid)
+{
+    for (uint32_t i = 0; i < l->len; i++) {
+        if (l->e[i].to != to) continue;
+        if (w < l->e[i].w) l->e[i] = (CHEdge){ to, w, mid };
+        return true;
+    }
+    return list_push(l, to, w, mid);
+}
+
+// Drop the edge -> to (order is not kept).
+static void list_remove(CHList *l, uint32_t to)
+{
+    for (uint32_t i = 0; i < l->len; i++) {
+        if (l->e[i].to != to) continue;
+        l->e[i] = l->e[--l->len];
+        return;
+    }
+}
+
+// Bounded Dijkstra from src over the remaining graph, never entering 'skip'.
+static void witness_search(CHBuild *b, uint32_t src, uint32_t skip, int limit)
+{
+    if (++b->wepoch == 0) {
+        memset(b->wstamp, 0, b->n * sizeof(uint32_t));
+        b->wepoch = 1;
+    }
+    iheap_clear(b->wpq);
+    b->wstamp[src] = b->wepoch;
+    b->wdist[src] = 0;
+    iheap_push(b->wpq, src, 0);
+
+    for (int settled = 0; settled < CH_WITNESS_SETTLE_LIMIT; settled++) {
+        int du;
+        size_t u = iheap_extract_min(b->wpq, &du);
+        if (u == SIZE_MAX || du > limit) break;
+        const CHList *l = &b->rem[u];
+        for (uint32_t i = 0; i < l->len; i++) {
+            uint32_t v = l->e[i].to;
+            int nd = du + l->e[i].w;
+            if (v == skip || nd > limit) continue;
+            if (b->wstamp[v] != b->wepoch) {
+                b->wstamp[v] = b->wepoch;
+                b->wdist[v] = nd;
+                iheap_push(b->wpq, v, nd);
+            } else if (nd < b->wdist[v] && iheap_contains(b->wpq, v)) {
+                b->wdist[v] = nd;
+                iheap_decrease_key(b->wpq, v, nd);
+            }
+        }
+    }
+}
+
+/*
+ * Helper: contract
+ * ----------------
+ * Counts the shortcuts contracting v needs; with 'apply', also inserts them
+ * into the remaining graph. Returns -1 on OOM.
+ */
+static int contract(CHBuild *b, uint32_t v, bool apply)
+{
+    const CHList *l = &b->rem[v];
+    int maxw = 0, count = 0;
+    for (uint32_t i = 0; i < l->len; i++)
+        if (l->e[i].w > maxw) maxw = l->e[i].w;
+
+    for (uint32_t i = 0; i + 1 < l->len; i++) {
+        uint32_t a = l->e[i].to;
+        int wa = l->e[i].w;
+        witness_search(b, a, v, wa + maxw);
+        for (uint32_t j = i + 1; j < l->len; j++) {
+            uint32_t c = l->e[j].to;
+            int need = wa + l->e[j].w;
+            if (b->wstamp[c] == b->wepoch && b->wdist[c] <= need) continue;  // Witness
+            count++;
+            if (apply && (!list_set_min(&b->rem[a], c, need, v) ||
+                          !list_set_min(&b->rem[c], a, need, v)))
+                return -1;
+        }
+    }
+    return count;
+}
+
+// Contraction priority, shifted to a non-negative heap key.
+static int priority_key(CHBuild *b, uint32_t v)
+{
+    return contract(b, v, false) - (int)b->rem[v].len + b->deleted[v] + (int)b->n;
+}
+
+static void build_free(CHBuild *b)
+{
+    for (size_t v = 0; b->rem && v < b->n; v++) free(b->rem[v].e);
+    for (size_t v = 0; b->up && v < b->n; v++) free(b->up[v].e);
+    free(b->rem);
+    free(b->up);
+    free(b->deleted);
+    free(b->wstamp);
+    free(b->wdist);
+    iheap_destroy(b->wpq);
+}
+
+/*
+ * Function: ch_build
+ * ------------------
+ * Node ordering, shortcut insertion and the upward graph in one pass.
+ * The downward graph of the textbook description is the same rows read in
+ * the other direction (the graph is undirected), so only one is stored.
+ */
+CHIndex *ch_build(const GraphCSR *csr)
+{
+    if (!csr) return NULL;
+    size_t n = csr->n, cap = n ? n : 1;
+    CHIndex *ch = index_alloc(csr);
+    if (!ch) return NULL;
+    ch->fingerprint = csr_fingerprint(csr);
+
+    CHBuild b = { 0 };
+    b.n = n;
+    b.rem     = calloc(cap, sizeof(CHList));
+    b.up      = calloc(cap, sizeof(CHList));
+    b.deleted = calloc(cap, sizeof(int));
+    b.wstamp  = calloc(cap, sizeof(uint32_t));
+    b.wdist   = malloc(cap * sizeof(int));
+    b.wpq     = iheap_create(n);
+    IndexedHeap *order = iheap_create(n);
+    bool ok = b.rem && b.up && b.deleted && b.wstamp && b.wdist && b.wpq && order;
+
+    // --- Remaining graph = the snapshot ---
+    for (size_t u = 0; ok && u < n; u++) {
+        for (size_t k = csr->offsets[u]; ok && k < csr->offsets[u + 1]; k++) {
+            if (csr->weights[k] < 1) ok = false;
+            else if (csr->adj[k] != u)
+                ok = list_set_min(&b.rem[u], csr->adj[k], csr->weights[k], CH_NO_MID);
+        }
+    }
+
+    // --- Contract in priority order (lazy updates) ---
+    for (size_t v = 0; ok && v < n; v++)
+        iheap_push(order, v, priority_key(&b, (uint32_t)v));
+    uint32_t next_rank = 0;
+    while (ok && !iheap_is_empty(order)) {
+        uint32_t v = (uint32_t)iheap_extract_min(order, NULL);
+        int key = priority_key(&b, v), top;
+        if (iheap_peek_min(order, &top) != SIZE_MAX && key > top) {
+            iheap_push(order, v, key);
+            continue;
+        }
+        if (contract(&b, v, true) < 0) { ok = false; break; }
+        b.up[v] = b.rem[v];                       // Every remaining neighbour ranks higher
+        b.rem[v] = (CHList){ NULL, 0, 0 };
+        for (uint32_t i = 0; i < b.up[v].len; i++) {
+            list_remove(&b.rem[b.up[v].e[i].to], v);
+            b.deleted[b.up[v].e[i].to]++;
+        }
+        ch->rank[v] = next_rank++;
+    }
+
+    // --- Upward graph in CSR layout ---
+    if (ok) {
+        for (size_t v = 0; v < n; v++) ch->up_off[v + 1] = ch->up_off[v] + b.up[v].len;
+        ch->m_up = ch->up_off[n];
+        ch->up_adj = malloc((ch->m_up ? ch->m_up : 1) * sizeof(uint32_t));
+        ch->up_w   = malloc((ch->m_up ? ch->m_up : 1) * sizeof(int));
+        ch->up_mid = malloc((ch->m_up ? ch->m_up : 1) * sizeof(uint32_t));
+        ok = ch->up_adj && ch->up_w && ch->up_mid;
+        for (size_t v = 0; ok && v < n; v++) {
+            for (uint32_t i = 0; i < b.up[v].len; i++) {
+                ch->up_adj[ch->up_off[v] + i] = b.up[v].e[i].to;
+                ch->up_w[ch->up_off[v] + i]   = b.up[v].e[i].w;
+                ch->up_mid[ch->up_off[v] + i] = b.up[v].e[i].mid;
+            }
+        }
+    }
+
+    iheap_destroy(order);
+    build_free(&b);
+    if (!ok) {
+        ch_destroy(ch);
+        return NULL;
+    }
+    return ch;
+}
+
+// ============================================================================
+// QUERY
+// ============================================================================
+
+// Start an upward search at 'root'.
+static void search_start(CHIndex *ch, CHSearch *S, uint32_t root)
+{
+    if (++S->epoch == 0) {
+        memset(S->stamp, 0, ch->n * sizeof(uint32_t));
+        S->epoch = 1;
+    }
+    iheap_clear(S->pq);
+    S->stamp[root] = S->epoch;
+    S->dist[root] = 0;
+    S->via[root] = SIZE_MAX;
+    iheap_push(S->pq, root, 0);
+}
+
+// Settle the closest queued vertex of S and relax its upward row.
+static uint32_t search_settle(CHIndex *ch, CHSearch *S, int *du)
+{
+    size_t u = iheap_extract_min(S->pq, du);
+    for (size_t k = ch->up_off[u]; k < ch->up_off[u + 1]; k++) {
+        uint32_t v = ch->up_adj[k];
+        int nd = *du + ch->up_w[k];
+        if (S->stamp[v] == S->epoch && nd >= S->dist[v]) continue;
+        if (S->stamp[v] != S->epoch) {
+            S->stamp[v] = S->epoch;
+            iheap_push(S->pq, v, nd);
+        } else {
+            iheap_decrease_key(S->pq, v, nd);
+        }
+        S->dist[v] = nd;
+        S->parent[v] = (uint32_t)u;
+        S->via[v] = k;
+    }
+    return (uint32_t)u;
+}
+
+/*
+ * Helper: upward_meet
+ * -------------------
+ * Bidirectional upward search: the smaller queue key goes next, and a side
+ * stops once its key reaches the best s-x-t sum found so far. Returns d(s, t)
+ * (INF if unreachable) and the top vertex of that path in *meet.
+ */
+static long upward_meet(CHIndex *ch, uint32_t s, uint32_t t, uint32_t *meet)
+{
+    search_start(ch, &ch->fwd, s);
+    search_start(ch, &ch->bwd, t);
+    long best = INF;
+    for (;;) {
+        int kf, kb;
+        bool f = iheap_peek_min(ch->fwd.pq, &kf) != SIZE_MAX && kf < best;
+        bool b = iheap_peek_min(ch->bwd.pq, &kb) != SIZE_MAX && kb < best;
+        if (!f && !b) break;
+        CHSearch *S = (f && (!b || kf <= kb)) ? &ch->fwd : &ch->bwd;
+        CHSearch *O = (S == &ch->fwd) ? &ch->bwd : &ch->fwd;
+        int du;
+        uint32_t u = search_settle(ch, S, &du);
+        if (O->stamp[u] == O->epoch && du + (long)O->dist[u] < best) {
+            best = du + (long)O->dist[u];
+            *meet = u;
+        }
+    }
+    return best;
+}
+
+// Entry of row 'lo' leading to 'to'; SIZE_MAX if there is none.
+static size_t row_find(const CHIndex *ch, uint32_t lo, uint32_t to)
+{
+    for (size_t k = ch->up_off[lo]; k < ch->up_off[lo + 1]; k++)
+        if (ch->up_adj[k] == to) return k;
+    return SIZE_MAX;
+}
+
+// Upward edge k of row 'lo', walked from its endpoint 'from'.
+typedef struct CHSpan {
+    size_t   k;
+    uint32_t lo, from;
+} CHSpan;
+
+/*
+ * Helper: unpack_edge
+ * -------------------
+ * Appends the original edges of span (k, lo, from) to 'path' as
+ * (vertex entered, weight), splitting shortcuts at their middle vertex with
+ * an explicit stack. A path longer than n vertices, or a middle without its
+ * two halves, means a damaged index. Returns false then, or on OOM.
+ */
+static bool unpack_edge(const CHIndex *ch, CHSpan span, CHList *path,
+                        CHSpan **stack, size_t *stack_cap)
+{
+    size_t top = 0;
+    (*stack)[top++] = span;
+    while (top > 0) {
+        CHSpan e = (*stack)[--top];
+        uint32_t to = (e.from == e.lo) ? ch->up_adj[e.k] : e.lo;
+        uint32_t m = ch->up_mid[e.k];
+        if (m == CH_NO_MID) {
+            if (path->len >= ch->n || !list_push(path, to, ch->up_w[e.k], CH_NO_MID))
+                return false;
+            continue;
+        }
+        size_t k1 = row_find(ch, m, e.from), k2 = row_find(ch, m, to);
+        if (k1 == SIZE_MAX || k2 == SIZE_MAX) return false;
+        if (top + 2 > *stack_cap) {
+            size_t cap = 2 * *stack_cap;
+            CHSpan *grown = realloc(*stack, cap * sizeof(CHSpan));
+            if (!grown) return false;
+            *stack = grown;
+            *stack_cap = cap;
+        }
+        (*stack)[top++] = (CHSpan){ k2, m, m };       // Second half: m -> to
+        (*stack)[top++] = (CHSpan){ k1, m, e.from };  // First half: from -> m
+    }
+    return true;
+}
+
+/*
+ * Helper: unpack_path
+ * -------------------
+ * The s-t path of the bidirectional search in original edges: path->e[0] is
+ * s (weight 0), then every vertex with the weight of the edge into it.
+ */
+static bool unpack_path(CHIndex *ch, uint32_t s, uint32_t meet, CHList *path)
+{
+    size_t cap = 16, len = 0, stack_cap = 16;
+    size_t *up = malloc(cap * sizeof(size_t));     // Forward tree edges, meet first
+    CHSpan *stack = malloc(stack_cap * sizeof(CHSpan));
+    bool ok = up && stack && list_push(path, s, 0, CH_NO_MID);
+    for (uint32_t x = meet; ok && x != s; x = ch->fwd.parent[x]) {
+        if (len == cap) {
+            size_t *grown = realloc(up, 2 * cap * sizeof(size_t));
+            if (!grown) { ok = false; break; }
+            up = grown;
+            cap *= 2;
+        }
+        up[len++] = ch->fwd.via[x];
+    }
+    // s up to meet, then meet down to t along the backward tree
+    for (size_t i = len; ok && i-- > 0;) {
+        uint32_t lo = ch->fwd.parent[ch->up_adj[up[i]]];
+        ok = unpack_edge(ch, (CHSpan){ up[i], lo, lo }, path, &stack, &stack_cap);
+    }
+    for (uint32_t x = meet; ok && ch->bwd.via[x] != SIZE_MAX; x = ch->bwd.parent[x])
+        ok = unpack_edge(ch, (CHSpan){ ch->bwd.via[x], ch->bwd.parent[x], x }, path,
+                         &stack, &stack_cap);
+    free(up);
+    free(stack);
+    return ok;
+}
+
+/*
+ * Helper: exact_dist
+ * ------------------
+ * d(s, u) from the upward search space of s, by the recurrence
+ *     d(s, x) = min( up_s(x), min over upward edges x -> y of d(s, y) + w )
+ * evaluated depth-first over the upward graph (a DAG: ranks increase) and
+ * memoised for the rest of the query, so the candidates of a whole path walk
+ * share one evaluation of their (mostly common) upward spaces. via_x[x]
+ * keeps the winning edge (SIZE_MAX: the up_s term) for first_hop.
+ *
+ * The forward search stopped at key d(s, t), so up_s is exact below that and
+ * an upper bound above it: the result is exact whenever d(s, u) < d(s, t),
+ * which covers every tight-predecessor test of the walk, and never too low.
+ * Returns INF if unreachable, -1 on OOM.
+ */
+static long exact_dist(CHIndex *ch, uint32_t u)
+{
+    if (ch->stamp_x[u] == ch->epoch_x && ch->state_x[u] == 2) return ch->dist_x[u];
+
+    size_t top = 0;
+    if (ch->stack_cap == 0) {
+        ch->stack = malloc(64 * sizeof(uint32_t));
+        if (!ch->stack) return -1;
+        ch->stack_cap = 64;
+    }
+    ch->stack[top++] = u;
+    while (top > 0) {
+        uint32_t x = ch->stack[top - 1];
+        if (ch->stamp_x[x] != ch->epoch_x) {     // First visit: queue unknown parents
+            ch->stamp_x[x] = ch->epoch_x;
+            ch->state_x[x] = 1;
+            size_t need = top + (ch->up_off[x + 1] - ch->up_off[x]);
+            if (need > ch->stack_cap) {
+                size_t cap = ch->stack_cap;
+                while (cap < need) cap *= 2;
+                uint32_t *grown = realloc(ch->stack, cap * sizeof(uint32_t));
+                if (!grown) return -1;
+                ch->stack = grown;
+                ch->stack_cap = cap;
+            }
+            for (size_t k = ch->up_off[x]; k < ch->up_off[x + 1]; k++) {
+                uint32_t y = ch->up_adj[k];
+                if (ch->stamp_x[y] != ch->epoch_x) ch->stack[top++] = y;
+            }
+            continue;
+        }
+        top--;
+        if (ch->state_x[x] == 2) continue;       // Duplicate entry, already done
+        long d = (ch->fwd.stamp[x] == ch->fwd.epoch) ? ch->fwd.dist[x] : INF;
+        size_t via = SIZE_MAX;
+        for (size_t k = ch->up_off[x]; k < ch->up_off[x + 1]; k++) {
+            long dy = ch->dist_x[ch->up_adj[k]];
+            if (dy != INF && dy + ch->up_w[k] < d) {
+                d = dy + ch->up_w[k];
+                via = k;
+            }
+        }
+        ch->dist_x[x] = (int)d;
+        ch->via_x[x] = via;
+        ch->state_x[x] = 2;
+    }
+    return ch->dist_x[u];
+}
+
+/*
+ * Helper: first_hop
+ * -----------------
+ * Last original edge into v on the shortest s-v path exact_dist(v) found
+ * (call exact_dist(v) first):
+ * the winning CH edge, split at middle vertices until the piece at v is an
+ * original edge. Its far end is a tight predecessor of v.
+ */
+static bool first_hop(const CHIndex *ch, uint32_t v, CHEdge *hop)
+{
+    size_t k = ch->via_x[v];
+    uint32_t lo = v;
+    if (k == SIZE_MAX) {                        // Reached through the source's space
+        k = ch->fwd.via[v];
+        lo = ch->fwd.parent[v];
+    }
+    while (ch->up_mid[k] != CH_NO_MID) {
+        lo = ch->up_mid[k];
+        k = row_find(ch, lo, v);
+        if (k == SIZE_MAX) return false;
+    }
+    *hop = (CHEdge){ (v == lo) ? ch->up_adj[k] : lo, ch->up_w[k], CH_NO_MID };
+    return true;
+}
+
+/*
+ * Function: ch_query
+ * ------------------
+ * Distance from the bidirectional upward search, then the parent-rule walk
+ * from the target.
+ */
+bool ch_query(CHIndex *ch, long source, long target, SPPath *out)
+{
+    if (!out) return false;
+    memset(out, 0, sizeof *out);
+    if (!ch || source < 0 || target < 0 ||
+        (size_t)source >= ch->n || (size_t)target >= ch->n)
+        return false;
+
+    uint32_t s = (uint32_t)source, meet = s;
+    long dist = upward_meet(ch, s, (uint32_t)target, &meet);
+    if (dist == INF) return true;               // Unreachable
+
+    CHList path = { NULL, 0, 0 };
+    if (!unpack_path(ch, s, meet, &path)) goto fail;
+    long sum = 0;
+    for (uint32_t i = 0; i < path.len; i++) sum += path.e[i].w;
+    if (sum != dist || path.e[path.len - 1].to != (uint32_t)target) goto fail;   // Damaged index
+    if (++ch->epoch_x == 0) {                   // New memo for exact_dist
+        memset(ch->stamp_x, 0, ch->n * sizeof(uint32_t));
+        ch->epoch_x = 1;
+    }
+
+    const GraphCSR *csr = ch->csr;
+    size_t cap = 16, len = 0;
+    int *rev = malloc(cap * sizeof(int));
+    if (!rev) goto fail;
+    uint32_t v = (uint32_t)target, at = path.len - 1;   // v == path.e[at].to while on it
+    bool on_path = true;
+    long dv = dist;
+    rev[len++] = (int)v;
+    while (v != s) {
+        // --- Known tight predecessor: the unpacked path, else exact_dist's edge ---
+        CHEdge best;
+        if (on_path) best = (CHEdge){ path.e[at - 1].to, path.e[at].w, CH_NO_MID };
+        else if (exact_dist(ch, v) < 0 || !first_hop(ch, v, &best)) goto fail_rev;
+
+        // --- Only edges that rank before it in the parent rule need d(s, u) ---
+        for (size_t k = csr->offsets[v]; k < csr->offsets[v + 1]; k++) {
+            uint32_t u = csr->adj[k];
+            int w = csr->weights[k];
+            if (w < best.w || (w == best.w && u <= best.to) || w > dv) continue;
+            long d = exact_dist(ch, u);
+            if (d < 0) goto fail_rev;
+            if (d == dv - w) best = (CHEdge){ u, w, CH_NO_MID };
+        }
+
+        on_path = on_path && best.to == path.e[at - 1].to && best.w == path.e[at].w;
+        if (on_path) at--;
+        v = best.to;
+        dv -= best.w;
+        if (dv < 0 || (dv == 0 && v != s)) goto fail_rev;   // Damaged index
+        if (len == cap) {
+            int *grown = realloc(rev, 2 * cap * sizeof(int));
+            if (!grown) goto fail_rev;
+            rev = grown;
+            cap *= 2;
+        }
+        rev[len++] = (int)v;
+    }
+    free(path.e);
+
+    // Source first
+    for (size_t i = 0; i < len / 2; i++) {
+        int tmp = rev[i];
+        rev[i] = rev[len - 1 - i];
+        rev[len - 1 - i] = tmp;
+    }
+    out->vertices = rev;
+    out->len = len;
+    out->cost = (int)dist;
+    return true;
+
+fail_rev:
+    free(rev);
+fail:
+    free(path.e);
+    return false;
+}
+
+// Command 9 through the index; output identical to shortestPath.
+void ch_print(CHIndex *ch, const char *start, const char *end)
+{
+    SPPath p;
+    long s = (ch && start) ? graph_csr_index_of(ch->csr, start) : -1;
+    long t = (ch && end)   ? graph_csr_index_of(ch->csr, end)   : -1;
+    if (!ch_query(ch, s, t, &p)) {
+        printf("0\n");
+        return;
+    }
+    sp_path_print(ch->csr, &p);
+    sp_path_free(&p);
+}
+
+// ============================================================================
+// INDEX FILE
+// ============================================================================
+typedef struct CHFileHeader {
+    char     magic[8];     // CH_FILE_MAGIC
+    uint32_t version;      // CH_FILE_VERSION
+    uint32_t endian;       // CH_FILE_ENDIAN
+    uint64_t n;            // Snapshot vertex count
+    uint64_t m;            // Snapshot adjacency entries
+    uint64_t m_up;         // Upward edges in the index
+    uint64_t fingerprint;  // csr_fingerprint() of the snapshot
+} CHFileHeader;
+
+bool ch_save(const CHIndex *ch, const char *path)
+{
+    if (!ch || !path) return false;
+    CHFileHeader h;
+    memset(&h, 0, sizeof h);
+    memcpy(h.magic, CH_FILE_MAGIC, sizeof h.magic);
+    h.version = CH_FILE_VERSION;
+    h.endian = CH_FILE_ENDIAN;
+    h.n = ch->n;
+    h.m = ch->csr->m;
+    h.m_up = ch->m_up;
+    h.fingerprint = ch->fingerprint;
+
+    FILE *f = fopen(path, "wb");
+    if (!f) return false;
+    bool ok = fwrite(&h, sizeof h, 1, f) == 1 &&
+              (ch->n == 0 || fwrite(ch->rank, sizeof(uint32_t), ch->n, f) == ch->n);
+    for (size_t i = 0; ok && i <= ch->n; i++) {
+        uint64_t off = ch->up_off[i];
+        ok = fwrite(&off, sizeof off, 1, f) == 1;
+    }
+    ok = ok && (ch->m_up == 0 || fwrite(ch->up_adj, sizeof(uint32_t), ch->m_up, f) == ch->m_up);
+    for (size_t k = 0; ok && k < ch->m_up; k++) {
+        int32_t w = ch->up_w[k];
+        ok = fwrite(&w, sizeof w, 1, f) == 1;
+    }
+    ok = ok && (ch->m_up == 0 || fwrite(ch->up_mid, sizeof(uint32_t), ch->m_up, f) == ch->m_up);
+    if (fclose(f) != 0) ok = false;
+    if (!ok) remove(path);
+    return ok;
+}
+
+CHIndex *ch_load(const char *path, const GraphCSR *csr)
+{
+    if (!path || !csr) return NULL;
+    FILE *f = fopen(path, "rb");
+    if (!f) return NULL;
+
+    CHFileHeader h;
+    CHIndex *ch = NULL;
+    if (fread(&h, sizeof h, 1, f) != 1) goto fail;
+    if (memcmp(h.magic, CH_FILE_MAGIC, sizeof h.magic) != 0 ||
+        h.version != CH_FILE_VERSION || h.endian != CH_FILE_ENDIAN ||
+        h.n != csr->n || h.m != csr->m || h.m_up > SIZE_MAX / sizeof(int))
+        goto fail;
+    if (h.fingerprint != csr_fingerprint(csr)) goto fail;   // Built from another graph
+
+    ch = index_alloc(csr);
+    if (!ch) goto fail;
+    ch->fingerprint = h.fingerprint;
+    ch->m_up = (size_t)h.m_up;
+    ch->up_adj = malloc((ch->m_up ? ch->m_up : 1) * sizeof(uint32_t));
+    ch->up_w   = malloc((ch->m_up ? ch->m_up : 1) * sizeof(int));
+    ch->up_mid = malloc((ch->m_up ? ch->m_up : 1) * sizeof(uint32_t));
+    if (!ch->up_adj || !ch->up_w || !ch->up_mid) goto fail;
+
+    // --- Sections, each checked before use ---
+    if (ch->n && fread(ch->rank, sizeof(uint32_t), ch->n, f) != ch->n) goto fail;
+    for (size_t i = 0; i < ch->n; i++)
+        if (ch->rank[i] >= ch->n) goto fail;
+    for (size_t i = 0; i <= ch->n; i++) {
+        uint64_t off;
+        if (fread(&off, sizeof off, 1, f) != 1) goto fail;
+        if (off > h.m_up || (i > 0 && off < ch->up_off[i - 1]) || (i == 0 && off != 0)) goto fail;
+        ch->up_off[i] = (size_t)off;
+    }
+    if (ch->up_off[ch->n] != ch->m_up) goto fail;
+    if (ch->m_up && fread(ch->up_adj, sizeof(uint32_t), ch->m_up, f) != ch->m_up) goto fail;
+    for (size_t k = 0; k < ch->m_up; k++) {
+        int32_t w;
+        if (fread(&w, sizeof w, 1, f) != 1 || w < 1 || ch->up_adj[k] >= ch->n) goto fail;
+        ch->up_w[k] = w;
+    }
+    // A middle ranks below both ends, so unpacking always terminates
+    if (ch->m_up && fread(ch->up_mid, sizeof(uint32_t), ch->m_up, f) != ch->m_up) goto fail;
+    for (size_t v = 0; v < ch->n; v++) {
+        for (size_t k = ch->up_off[v]; k < ch->up_off[v + 1]; k++) {
+            uint32_t m = ch->up_mid[k];
+            if (m != CH_NO_MID && (m >= ch->n || ch->rank[m] >= ch->rank[v] ||
+                                   ch->rank[m] >= ch->rank[ch->up_adj[k]]))
+                goto fail;
+        }
+    }
+    if (fgetc(f) != EOF) goto fail;                          // Trailing bytes
+    fclose(f);
+    return ch;
+
+fail:
+    ch_destroy(ch);
+    fclose(f);
+    return NULL;
+}
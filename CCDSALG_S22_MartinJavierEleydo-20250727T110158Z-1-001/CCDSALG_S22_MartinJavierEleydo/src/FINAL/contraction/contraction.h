@@ -0,0 +1,56 @@
+/* ============================================================================
+ *  contraction.h – Contraction hierarchies (CH) index for command-9 queries
+ * ----------------------------------------------------------------------------
+ *  Preprocesses a CSR snapshot once so that point-to-point shortest paths
+ *  only explore two small "upward" search spaces instead of a Dijkstra ball.
+ *
+ *  Specification:
+ *    - ch_build(csr): orders the vertices, contracts them one by one and keeps
+ *      every edge (original or shortcut) from a vertex to a higher-ranked one.
+ *    - ch_query(): exact distance plus the path shortestPath() prints
+ *      ("A -> B -> C; Total edge cost = N"), as an SPPath.
+ *    - ch_save()/ch_load(): binary index file; loading checks that the file
+ *      was built from the same snapshot (vertex/edge counts and a fingerprint
+ *      of the adjacency arrays) and rejects it otherwise.
+ *
+ *  The index borrows the snapshot it was built for (queries read the original
+ *  adjacency to rebuild the path). Queries on one index must not run
+ *  concurrently; they share scratch arrays.
+ * ============================================================================
+ */
+
+#ifndef CONTRACTION_H
+#define CONTRACTION_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "graph.h"
+#include "shortest_Path.h"
+
+typedef struct CHIndex CHIndex;
+
+// Contract every vertex of 'csr'. Returns NULL on OOM or a weight below 1.
+CHIndex *ch_build(const GraphCSR *csr);
+
+// Release an index (built or loaded). Safe on NULL.
+void ch_destroy(CHIndex *ch);
+
+// Number of upward edges (original edges plus shortcuts, each stored once).
+size_t ch_edge_count(const CHIndex *ch);
+
+// Shortest path between snapshot indices; same path shortestPath() prints
+// (len 0: unreachable). Returns false on bad indices or OOM.
+bool ch_query(CHIndex *ch, long source, long target, SPPath *out);
+
+// Command 9 through the index ("0" on a missing vertex or no path).
+void ch_print(CHIndex *ch, const char *startName, const char *endName);
+
+// Write the index to 'path'. Returns false on I/O error.
+bool ch_save(const CHIndex *ch, const char *path);
+
+// Read an index written by ch_save for this same snapshot. Returns NULL if the
+// file is missing, malformed, built from a different graph, or on OOM.
+CHIndex *ch_load(const char *path, const GraphCSR *csr);
+
+#endif /* CONTRACTION_H */
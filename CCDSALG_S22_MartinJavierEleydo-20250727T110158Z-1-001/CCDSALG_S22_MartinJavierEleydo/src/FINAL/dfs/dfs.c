@@ -14,83 +14,13 @@
 #include <string.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #include "stack.h"   // Step 0: Use stack module for iterative traversal.
 #include "graph.h"   // Step 0: Opaque Graph type.
+#include "graph_internal.h" // Step 0: Index/adjacency-span view.
 #include "dfs.h"     // Step 0: Public declaration.
 
-/*
- * --- Shadow Struct Definitions ---
- * ---------------------------------
- * These struct definitions are duplicated from the private implementation in graph.c
- * to allow DFS module direct access to internal members for efficient traversal.
- * KEEP IN SYNC with graph.c to preserve correctness and information hiding.
- */
-typedef struct Vertex Vertex;
-
-typedef struct AdjNode {
-    Vertex          *dst;
-    int             weight;
-    struct AdjNode  *next;
-} AdjNode;
-
-struct Vertex {
-    char            name[257];
-    AdjNode         *adj;
-    Vertex          *next;
-};
-
-struct Graph {
-    Vertex *v_head;
-    size_t  v_count;
-    size_t  e_count;
-};
-
-/*
- * FUNCTION: build_index_map
- * -------------------------
- * Builds a flat array of vertex pointers from the graph's linked list
- * for O(1) access by integer index, enabling an efficient visited array.
- *
- * Parameters:
- * - g: the graph
- * - out: pointer to array of Vertex pointers (output)
- * Returns: number of vertices in the graph
- */
-static size_t build_index_map(const Graph *g, const Vertex ***out)
-{
-    size_t n = g->v_count;
-    Vertex **vec = malloc(n * sizeof(Vertex*));
-    if (!vec) { *out = NULL; return 0; }
-    size_t i = 0; for (Vertex *v = g->v_head; v; v = v->next) vec[i++] = v;
-    *out = (const Vertex **)vec;
-    return n;
-}
-
-/*
- * FUNCTION: index_of
- * ------------------
- * Performs a binary search to find the index of a vertex by name in a sorted map.
- * O(log V) lookup.
- *
- * Parameters:
- * - vec: sorted array of vertex pointers
- * - n: number of vertices
- * - name: name to search for
- * Returns: integer index if found, otherwise -1
- */
-static ptrdiff_t index_of(const Vertex **vec, size_t n, const char *name)
-{
-    size_t lo = 0, hi = n;
-    while (lo < hi) {
-        size_t mid = (lo + hi) >> 1;
-        int cmp = strcmp(vec[mid]->name, name);
-        if (cmp == 0) return (ptrdiff_t)mid;
-        (cmp < 0) ? (lo = mid + 1) : (hi = mid);
-    }
-    return -1;
-}
-
 /*
  * FUNCTION: cmd_dfs
  * -----------------
@@ -98,6 +28,12 @@ static ptrdiff_t index_of(const Vertex **vec, size_t n, const char *name)
  * Traverses the graph from a starting vertex, exploring as far as possible
  * along each branch before backtracking. Prints each vertex upon first discovery.
  *
+ * The start name is resolved to a VertexId once; the loop itself works on
+ * ids only. Stack entries point into a per-id name table, so a popped
+ * entry's id is a pointer difference and printing needs no lookup.
+ * Neighbors are read through the graph's adjacency spans (graph_internal.h),
+ * so nothing is copied per vertex.
+ *
  * Parameters:
  * - g: pointer to the Graph structure
  * - start: name of the starting vertex
@@ -105,65 +41,97 @@ static ptrdiff_t index_of(const Vertex **vec, size_t n, const char *name)
  */
 void cmd_dfs(Graph *g, const char *start, Stack *scratch)
 {
-    // Step 1: Validate input parameters.
-    if (!g || !start) { putchar('\n'); return; }
+    // Step 1: Validate input parameters and resolve the start vertex.
+    VertexId s_id = graph_vertex_id(g, start);
+    if (s_id == GRAPH_NO_VERTEX) { putchar('\n'); return; }
 
     // Step 2: Build lookup structures for traversal.
-    // Build a temporary, sorted array of vertex pointers for fast index-based lookup.
-    const Vertex **vec = NULL;
-    size_t V = build_index_map(g, &vec);
-    if (V == 0) { putchar('\n'); return; }
-
-    // Allocate a boolean array (bitmap) for O(1) 'visited' checks.
+    // names[id] for printing and visited[id] for O(1) checks.
+    size_t V = graph_index_bound(g);
+    const char **names = malloc(V * sizeof(const char *));
     bool *visited = calloc(V, sizeof(bool));
-    if (!visited) { free((void*)vec); putchar('\n'); return; }
-
-    // Find integer index of the starting vertex.
-    ptrdiff_t s_idx = index_of(vec, V, start);
-    if (s_idx < 0) {
-        free((void*)vec); free(visited); putchar('\n'); return;
-    }
+    if (!names || !visited) { free(names); free(visited); putchar('\n'); return; }
+    graph_get_names_by_id(g, names);
 
     // Step 3: Initialize stack with the starting vertex.
     while (!stack_is_empty(scratch)) (void)stack_pop(scratch);
-    stack_push(scratch, (void*)vec[s_idx]);
+    stack_push(scratch, (void *)&names[s_id]);
 
     // Step 4: Main traversal loop.
     while (!stack_is_empty(scratch)) {
-        Vertex *u = (Vertex *)stack_pop(scratch);
-        ptrdiff_t u_idx = index_of(vec, V, u->name);
+        const char **entry = stack_pop(scratch);
+        VertexId u = (VertexId)(entry - names);
 
         // Skip already visited vertices.
-        if (visited[u_idx]) continue;
-        visited[u_idx] = true;
+        if (visited[u]) continue;
+        visited[u] = true;
 
         // Print newly visited vertex's name.
-        fputs(u->name, stdout);
+        fputs(*entry, stdout);
         putchar('\n');
 
         // Step 5: Process all neighbors of the current vertex.
-        // Copy neighbor pointers into a temporary buffer.
-        size_t deg = 0; for (AdjNode *a = u->adj; a; a = a->next) ++deg;
-        if (deg == 0) continue;
-        Vertex **buf = malloc(deg * sizeof(Vertex*));
-        if (!buf) break;
-        size_t i = 0; for (AdjNode *a = u->adj; a; a = a->next) buf[i++] = a->dst;
+        GraphAdjSpan span = graph_adj_span(g, u);
 
         // Push unvisited neighbors onto the stack in REVERSE lex order,
         // so they're popped and visited in correct order.
-        while (i--) {
-            ptrdiff_t v_idx = index_of(vec, V, buf[i]->name);
-            if (!visited[v_idx]) {
-                stack_push(scratch, buf[i]);
-            }
+        for (uint32_t i = span.deg; i-- > 0; ) {
+            VertexId v = span.adj[i].id;
+            if (!visited[v]) stack_push(scratch, (void *)&names[v]);
         }
-        free(buf);
     }
 
     // Step 6: Print a final newline for output formatting.
     putchar('\n');
 
     // Step 7: Cleanup. Free all memory allocated for this traversal.
-    free((void*)vec);
+    free(names);
+    free(visited);
+}
+
+/*
+ * FUNCTION: cmd_dfs_csr
+ * ---------------------
+ * Same traversal as cmd_dfs on a CSR snapshot. Stack entries point into
+ * csr->names, so a popped entry's index is a pointer difference and no
+ * name lookups happen inside the loop.
+ *
+ * Parameters:
+ * - csr: snapshot produced by graph_freeze()
+ * - start: name of the starting vertex
+ * - scratch: pre-allocated Stack for traversal
+ */
+void cmd_dfs_csr(const GraphCSR *csr, const char *start, Stack *scratch)
+{
+    // Step 1: Resolve the start vertex.
+    long s_idx = graph_csr_index_of(csr, start);
+    if (s_idx < 0) { putchar('\n'); return; }
+
+    bool *visited = calloc(csr->n, sizeof(bool));
+    if (!visited) { putchar('\n'); return; }
+
+    // Step 2: Initialize stack with the starting vertex.
+    while (!stack_is_empty(scratch)) (void)stack_pop(scratch);
+    stack_push(scratch, (void *)&csr->names[s_idx]);
+
+    // Step 3: Main traversal loop.
+    while (!stack_is_empty(scratch)) {
+        const char **entry = stack_pop(scratch);
+        size_t u = (size_t)(entry - csr->names);
+        if (visited[u]) continue;
+        visited[u] = true;
+
+        fputs(*entry, stdout);
+        putchar('\n');
+
+        // Push unvisited neighbors in REVERSE lex order so they pop in order.
+        for (size_t k = csr->offsets[u + 1]; k-- > csr->offsets[u]; ) {
+            uint32_t v = csr->adj[k];
+            if (!visited[v]) stack_push(scratch, (void *)&csr->names[v]);
+        }
+    }
+
+    // Step 4: Final newline and cleanup.
+    putchar('\n');
     free(visited);
 }
@@ -13,6 +13,13 @@
 //   ✔ No extraneous I/O; formatting is exactly as required
 //   ✔ All memory is managed robustly, freeing on partial failures to avoid leaks
 //   ✔ Edge count (`e_count`) reflects logical undirected edges, not adjacency entries
+//   ✔ Name lookups go through an open-addressing hash index (expected O(1))
+//   ✔ Every vertex has a stable dense VertexId; the ID API never touches names
+//   ✔ Names are interned once in a block arena; a Vertex holds only a handle
+//   ✔ Vertices come from a graph-owned slab, released in bulk
+//   ✔ Adjacency is a sorted (id, weight) array per vertex; edge lookups are O(log deg)
+//   ✔ Bulk loads buffer edges and build the sorted structures in one pass
+//   ✔ Connectivity is tracked by a union-find index, so path checks are O(α(n))
 // ============================================================================
 
 #include <stdio.h>
@@ -20,8 +27,11 @@
 #include <string.h>
 #include <ctype.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
 #include "graph.h"   // Public interface for the Graph type and operations
+#include "graph_internal.h" // Index/span view for traversal modules
 
 // ============================================================================
 // CONSTANTS (Internal use only)
@@ -32,6 +42,11 @@
 #define MAX_NAME_LEN 256
 #define MIN_WEIGHT   1
 #define MAX_WEIGHT   100
+#define INDEX_MIN_CAP 16   // Initial hash index size (power of two)
+#define ARENA_BLOCK   4096 // Default name arena block size in bytes
+#define SLAB_MIN_OBJS 64   // Objects in the first slab chunk (doubles after)
+#define SLAB_MAX_OBJS 65536 // Cap on objects per slab chunk
+#define ADJ_MIN_CAP   4    // Initial adjacency array capacity
 
 // ============================================================================
 // NAME VALIDATION
@@ -56,57 +71,233 @@ static bool is_valid_name(const char *name)
 // ============================================================================
 // INTERNAL STRUCTURES
 // ----------------------------------------------------------------------------
-// Vertex:  Represents a node in the graph, stores its name and adjacency list.
-// AdjNode: Represents a single neighbor connection (edge) in the adjacency list.
+// Vertex:  Represents a node in the graph, stores its name handle and adjacency list.
+// AdjEntry: Represents a single neighbor connection (edge) in an adjacency array.
 // Graph  : The main structure containing all vertices and edge/vertex counts.
 //
-// Note: All lists (vertices, neighbors) are kept in lexicographically sorted order
-// to ensure deterministic traversal and output order.
+// Vertex ids are assigned in insertion order (0, 1, 2, ...) and never change;
+// by_id[] maps an id back to its Vertex in O(1).
+//
+// Vertex names live in a NameArena owned by the graph (see NAME ARENA below);
+// Vertex.name is a handle into it, so a Vertex is a few words instead of
+// carrying a MAX_NAME_LEN + 1 byte inline buffer.
+//
+// Note: The vertex list and every adjacency array are kept in lexicographically
+// sorted order (adjacency by neighbor name) to ensure deterministic traversal
+// and output order, and so edge lookups can binary search.
 // ============================================================================
-struct Vertex;  // Forward declaration so AdjNode can reference Vertex
-
-typedef struct AdjNode {
-    struct Vertex *dst;   // Pointer to the neighboring vertex (destination)
-    int            weight; // Edge weight (1–100)
-    struct AdjNode *next; // Next neighbor in sorted adjacency list
-} AdjNode;
+// AdjEntry is the public GraphNeighbor (id, weight) pair, so the neighbor
+// iterator can hand out pointers into the adjacency arrays directly.
+typedef GraphNeighbor AdjEntry;
 
 typedef struct Vertex {
-    char           name[MAX_NAME_LEN + 1]; // Null-terminated string
-    AdjNode       *adj;   // Head pointer for adjacency (neighbor) list
+    const char    *name;  // Interned name (handle into the graph's NameArena)
+    AdjEntry      *adj;   // Neighbors, sorted by name (deg entries used)
+    uint32_t       deg;   // Number of neighbors
+    uint32_t       adj_cap; // Allocated length of adj
     struct Vertex *next;  // Next vertex in the global vertex list
+    VertexId       id;    // Stable dense id (insertion order)
 } Vertex;
 
+// One slot of the name index; v == NULL marks an empty slot.
+typedef struct IndexSlot {
+    Vertex   *v;      // Vertex stored in this slot
+    uint64_t  hash;   // Cached hash of v->name (skips most strcmp calls)
+} IndexSlot;
+
+// One block of the name arena; blocks are chained and never move, so name
+// handles stay valid for the lifetime of the graph.
+typedef struct ArenaBlock {
+    struct ArenaBlock *next; // Previously filled block
+    size_t used;             // Bytes of data[] in use
+    size_t cap;              // Bytes available in data[]
+    char   data[];           // Length-prefixed, NUL-terminated names
+} ArenaBlock;
+
+// An edge buffered by the bulk loader (arrival order is the sequence number).
+typedef struct BulkEdge {
+    VertexId u, v;
+    int      weight;
+} BulkEdge;
+
+typedef struct NameArena {
+    ArenaBlock *head;        // Block currently being filled
+} NameArena;
+
+// One chunk of a slab; objects are carved from data[] front to back.
+typedef struct SlabChunk {
+    struct SlabChunk *next;  // Previously filled chunk
+    max_align_t       data[]; // Object storage (aligned for any type)
+} SlabChunk;
+
+// Fixed-size object allocator: bump allocation inside chunks, with a free
+// list for objects handed back before the graph is destroyed.
+typedef struct Slab {
+    size_t     obj_size;     // Size of one object (>= sizeof(void *))
+    SlabChunk *chunks;       // All chunks, newest first
+    char      *cursor;       // Next unused byte in the newest chunk
+    size_t     left;         // Objects still available at cursor
+    size_t     next_objs;    // Object count for the next chunk
+    void      *free_list;    // Released objects (linked through first word)
+} Slab;
+
 struct Graph {
-    Vertex *v_head;   // Head pointer to global vertex list
-    size_t  v_count;  // Number of vertices
-    size_t  e_count;  // Logical undirected edge count
+    Vertex    *v_head;    // Head pointer to global vertex list
+    size_t     v_count;   // Number of vertices
+    size_t     e_count;   // Logical undirected edge count
+    Vertex    *v_tail;    // Last vertex in the list (O(1) in-order appends)
+    IndexSlot *index;     // Open-addressing hash index: name -> Vertex
+    size_t     index_cap; // Slot count (power of two, load factor <= 1/2)
+    Vertex   **by_id;     // by_id[id] -> Vertex (dense, v_count entries used)
+    size_t     by_id_cap; // Allocated length of by_id (and of uf_parent/uf_rank)
+    VertexId  *uf_parent; // Union-find parent per id (roots point to themselves)
+    uint8_t   *uf_rank;   // Union-find rank per id (upper bound on tree height)
+    NameArena  names;     // Storage for every vertex name
+    Slab       vertices;  // Storage for every Vertex
+    bool       bulk;      // True between graph_bulk_begin and graph_bulk_commit
+    size_t     bulk_first; // v_count at graph_bulk_begin (later ids are unlinked)
+    BulkEdge  *pending;   // Edges buffered in bulk mode, in arrival order
+    size_t     pending_len; // Number of buffered edges
+    size_t     pending_cap; // Allocated length of pending
 };
 
 // ============================================================================
-// VERTEX AND EDGE CREATION HELPERS
+// NAME ARENA
 // ----------------------------------------------------------------------------
-// These functions allocate and initialize Vertex or AdjNode structs safely.
-// - vertex_create: Allocates a new Vertex and copies the name safely
-// - adj_create   : Allocates an AdjNode, sets destination and weight
+// Every vertex name is stored exactly once, packed back to back in large
+// blocks: [len lo][len hi][chars...]['\0']. The handle is a pointer to the
+// first char, so it is a valid C string and the length sits just before it.
+// Deduplication comes from the name index: a name is only interned after the
+// index has confirmed no vertex already owns it.
+//
+// - arena_intern : Copies a name into the arena and returns its handle
+// - name_len     : O(1) length of an interned name (read from the prefix)
+// - name_copy    : Copies an interned name into a caller's fixed-size buffer
+// - arena_free   : Releases every block
 // ============================================================================
-static Vertex *vertex_create(const char *name)
+static const char *arena_intern(NameArena *a, const char *name, size_t len)
 {
-    Vertex *v = calloc(1, sizeof(Vertex));
-    if (!v) return NULL;
-    strncpy(v->name, name, MAX_NAME_LEN);
-    v->name[MAX_NAME_LEN] = '\0';  // Ensure null-termination
-    return v;
+    size_t need = len + 3;  // 2-byte length prefix + chars + NUL
+    ArenaBlock *b = a->head;
+    if (!b || b->cap - b->used < need) {
+        size_t cap = need > ARENA_BLOCK ? need : ARENA_BLOCK;
+        b = malloc(sizeof(ArenaBlock) + cap);
+        if (!b) return NULL;
+        b->next = a->head;
+        b->used = 0;
+        b->cap  = cap;
+        a->head = b;
+    }
+    unsigned char *p = (unsigned char *)b->data + b->used;
+    p[0] = (unsigned char)(len & 0xFF);
+    p[1] = (unsigned char)(len >> 8);
+    memcpy(p + 2, name, len);
+    p[2 + len] = '\0';
+    b->used += need;
+    return (const char *)(p + 2);
+}
+
+static size_t name_len(const char *handle)
+{
+    const unsigned char *p = (const unsigned char *)handle;
+    return (size_t)p[-2] | ((size_t)p[-1] << 8);
+}
+
+static void name_copy(char dst[MAX_NAME_LEN], const char *handle)
+{
+    size_t len = name_len(handle);
+    if (len > MAX_NAME_LEN - 1) len = MAX_NAME_LEN - 1;  // Always NUL-terminate
+    memcpy(dst, handle, len);
+    dst[len] = '\0';
+}
+
+static void arena_free(NameArena *a)
+{
+    ArenaBlock *b = a->head;
+    while (b) {
+        ArenaBlock *next = b->next;
+        free(b);
+        b = next;
+    }
+    a->head = NULL;
+}
+
+// ============================================================================
+// SLAB ALLOCATOR
+// ----------------------------------------------------------------------------
+// Vertices are small, fixed-size and (apart from failed inserts) live until
+// the graph is destroyed, so they are carved out of large
+// chunks instead of one malloc each. Chunk size doubles from SLAB_MIN_OBJS up
+// to SLAB_MAX_OBJS objects, and graph_destroy frees whole chunks at once.
+//
+// - slab_init   : Sets the object size of an empty slab
+// - slab_alloc  : Returns one object (free list first, then bump allocation)
+// - slab_release: Hands an object back for reuse
+// - slab_free   : Releases every chunk
+// ============================================================================
+static void slab_init(Slab *s, size_t obj_size)
+{
+    size_t align = sizeof(max_align_t);
+    if (obj_size < sizeof(void *)) obj_size = sizeof(void *);
+    s->obj_size = (obj_size + align - 1) / align * align;
+    s->next_objs = SLAB_MIN_OBJS;
 }
 
-static AdjNode *adj_create(Vertex *dst, int weight)
+static void *slab_alloc(Slab *s)
 {
-    AdjNode *a = malloc(sizeof(AdjNode));
-    if (!a) return NULL;
-    a->dst = dst;
-    a->weight = weight;
-    a->next = NULL;
-    return a;
+    if (s->free_list) {
+        void *obj = s->free_list;
+        s->free_list = *(void **)obj;
+        return obj;
+    }
+    if (s->left == 0) {
+        SlabChunk *c = malloc(sizeof(SlabChunk) + s->next_objs * s->obj_size);
+        if (!c) return NULL;
+        c->next = s->chunks;
+        s->chunks = c;
+        s->cursor = (char *)c->data;
+        s->left = s->next_objs;
+        if (s->next_objs < SLAB_MAX_OBJS) s->next_objs *= 2;
+    }
+    void *obj = s->cursor;
+    s->cursor += s->obj_size;
+    s->left--;
+    return obj;
+}
+
+static void slab_release(Slab *s, void *obj)
+{
+    *(void **)obj = s->free_list;
+    s->free_list = obj;
+}
+
+static void slab_free(Slab *s)
+{
+    SlabChunk *c = s->chunks;
+    while (c) {
+        SlabChunk *next = c->next;
+        free(c);
+        c = next;
+    }
+    s->chunks = NULL;
+    s->cursor = NULL;
+    s->left = 0;
+    s->free_list = NULL;
+}
+
+// ============================================================================
+// VERTEX AND EDGE CREATION HELPERS
+// ----------------------------------------------------------------------------
+// Allocates and initializes Vertex structs safely from the graph's slab.
+// - vertex_create: Allocates a new Vertex around an interned name handle
+// ============================================================================
+static Vertex *vertex_create(Graph *g, const char *name)
+{
+    Vertex *v = slab_alloc(&g->vertices);
+    if (!v) return NULL;
+    memset(v, 0, sizeof *v);
+    v->name = name;
+    return v;
 }
 
 // ============================================================================
@@ -115,8 +306,9 @@ static AdjNode *adj_create(Vertex *dst, int weight)
 // To keep all lists sorted, these helpers insert a new item at the correct spot.
 //
 // - vertex_list_insert: Inserts Vertex into vertex list sorted by name
-// - adj_list_insert   : Inserts AdjNode into neighbor list sorted by name
-// - adj_find          : Searches a sorted adjacency list for a destination name
+// - adj_search        : Binary search of an adjacency array for a neighbor
+// - adj_find_id       : Entry for a destination vertex id (or NULL)
+// - adj_insert        : Inserts an entry at a given position, growing the array
 // ============================================================================
 static void vertex_list_insert(Vertex **head, Vertex *v_new)
 {
@@ -127,28 +319,147 @@ static void vertex_list_insert(Vertex **head, Vertex *v_new)
     *head       = v_new;
 }
 
-static AdjNode *adj_find(AdjNode *head, const char *dst_name)
+static bool adj_search(const Graph *g, const Vertex *u, const Vertex *dst, size_t *pos)
 {
-    // Find the adjacency node whose destination matches dst_name
-    while (head && strcmp(head->dst->name, dst_name) < 0)
-        head = head->next;
-    return (head && strcmp(head->dst->name, dst_name) == 0) ? head : NULL;
+    // Entries are ordered by neighbor name; ids compare equal only on a hit
+    size_t lo = 0, hi = u->deg;
+    while (lo < hi) {
+        size_t mid = (lo + hi) >> 1;
+        VertexId id = u->adj[mid].id;
+        if (id == dst->id) { *pos = mid; return true; }
+        if (strcmp(g->by_id[id]->name, dst->name) < 0) lo = mid + 1;
+        else                                            hi = mid;
+    }
+    *pos = lo;
+    return false;
 }
 
-static void adj_list_insert(AdjNode **head, AdjNode *a_new)
+static AdjEntry *adj_find_id(const Graph *g, const Vertex *u, VertexId dst_id)
 {
-    // Find correct spot, insert or update weight if already present
-    while (*head && strcmp((*head)->dst->name, a_new->dst->name) < 0)
-        head = &(*head)->next;
-    if (*head && strcmp((*head)->dst->name, a_new->dst->name) == 0) {
-        // Duplicate: update weight
-        (*head)->weight = a_new->weight;
-        free(a_new);
-    } else {
-        // Insert new node
-        a_new->next = *head;
-        *head       = a_new;
+    size_t pos;
+    if (dst_id >= g->v_count) return NULL;
+    return adj_search(g, u, g->by_id[dst_id], &pos) ? &u->adj[pos] : NULL;
+}
+
+static bool adj_insert(Vertex *u, size_t pos, VertexId dst_id, int weight)
+{
+    if (u->deg == u->adj_cap) {
+        if (u->adj_cap > UINT32_MAX / 2) return false;
+        uint32_t new_cap = u->adj_cap ? u->adj_cap * 2 : ADJ_MIN_CAP;
+        AdjEntry *grown = realloc(u->adj, new_cap * sizeof(AdjEntry));
+        if (!grown) return false;
+        u->adj = grown;
+        u->adj_cap = new_cap;
+    }
+    memmove(&u->adj[pos + 1], &u->adj[pos], (u->deg - pos) * sizeof(AdjEntry));
+    u->adj[pos].id = dst_id;
+    u->adj[pos].weight = weight;
+    u->deg++;
+    return true;
+}
+
+// ============================================================================
+// NAME INDEX (open addressing, linear probing)
+// ----------------------------------------------------------------------------
+// A hash table from vertex name to Vertex*, kept alongside the sorted list so
+// every name-based API call resolves its vertices in expected O(1) instead of
+// walking the list. Vertices are never removed, so no tombstones are needed.
+//
+// - name_hash   : 64-bit FNV-1a of the name
+// - index_probe : Slot holding 'name', or the empty slot where it would go
+// - index_grow  : Doubles the table and reinserts every vertex
+// - index_insert: Adds a vertex, growing first to keep load factor <= 1/2
+// ============================================================================
+static uint64_t name_hash(const char *name)
+{
+    uint64_t h = 1469598103934665603ULL;
+    for (const unsigned char *p = (const unsigned char *)name; *p; ++p) {
+        h ^= *p;
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+static IndexSlot *index_probe(const Graph *g, const char *name, uint64_t h)
+{
+    size_t mask = g->index_cap - 1;
+    size_t i = (size_t)h & mask;
+    while (g->index[i].v) {
+        if (g->index[i].hash == h && strcmp(g->index[i].v->name, name) == 0)
+            break;
+        i = (i + 1) & mask;
     }
+    return &g->index[i];
+}
+
+static bool index_grow(Graph *g)
+{
+    size_t new_cap = g->index_cap ? g->index_cap * 2 : INDEX_MIN_CAP;
+    IndexSlot *fresh = calloc(new_cap, sizeof(IndexSlot));
+    if (!fresh) return false;
+    IndexSlot *old = g->index;
+    size_t old_cap = g->index_cap;
+    g->index = fresh;
+    g->index_cap = new_cap;
+    for (size_t i = 0; i < old_cap; ++i)
+        if (old[i].v) *index_probe(g, old[i].v->name, old[i].hash) = old[i];
+    free(old);
+    return true;
+}
+
+static bool index_insert(Graph *g, Vertex *v, uint64_t h)
+{
+    if (2 * (g->v_count + 1) > g->index_cap && !index_grow(g)) return false;
+    IndexSlot *slot = index_probe(g, v->name, h);
+    slot->v = v;
+    slot->hash = h;
+    return true;
+}
+
+// ============================================================================
+// ID TABLES AND CONNECTIVITY (union-find)
+// ----------------------------------------------------------------------------
+// by_id, uf_parent and uf_rank are all indexed by VertexId and grow together.
+// Edges are never removed, so components only ever merge and a disjoint-set
+// forest answers "are u and v connected?" exactly:
+//
+// - id_tables_grow: Doubles the capacity of all per-id tables
+// - uf_find       : Root of id's component, halving the path on the way up
+// - uf_union      : Merges two components, attaching the lower-rank root
+// ============================================================================
+static bool id_tables_grow(Graph *g)
+{
+    size_t new_cap = g->by_id_cap ? g->by_id_cap * 2 : INDEX_MIN_CAP;
+    Vertex **by_id = realloc(g->by_id, new_cap * sizeof(Vertex *));
+    if (!by_id) return false;
+    g->by_id = by_id;
+    VertexId *parent = realloc(g->uf_parent, new_cap * sizeof(VertexId));
+    if (!parent) return false;
+    g->uf_parent = parent;
+    uint8_t *rank = realloc(g->uf_rank, new_cap * sizeof(uint8_t));
+    if (!rank) return false;
+    g->uf_rank = rank;
+    g->by_id_cap = new_cap;
+    return true;
+}
+
+static VertexId uf_find(Graph *g, VertexId id)
+{
+    while (g->uf_parent[id] != id) {
+        g->uf_parent[id] = g->uf_parent[g->uf_parent[id]];  // Path halving
+        id = g->uf_parent[id];
+    }
+    return id;
+}
+
+static void uf_union(Graph *g, VertexId a, VertexId b)
+{
+    a = uf_find(g, a);
+    b = uf_find(g, b);
+    if (a == b) return;
+    if (g->uf_rank[a] < g->uf_rank[b]) { VertexId t = a; a = b; b = t; }
+    g->uf_parent[b] = a;
+    if (g->uf_rank[a] == g->uf_rank[b]) g->uf_rank[a]++;
 }
 
 // ============================================================================
@@ -160,51 +471,103 @@ static void adj_list_insert(AdjNode **head, AdjNode *a_new)
 // ============================================================================
 
 // Create a new, empty graph.
-Graph *graph_create(void) { return calloc(1, sizeof(Graph)); }
+Graph *graph_create(void)
+{
+    Graph *g = calloc(1, sizeof(Graph));
+    if (!g) return NULL;
+    slab_init(&g->vertices, sizeof(Vertex));
+    return g;
+}
 
-// Safely free all memory associated with the graph, including all vertices
-// and all adjacency nodes for every vertex. Does nothing if g is NULL.
+// Safely free all memory associated with the graph. Vertices and names are
+// owned by the slab/arena, so they are released a chunk at a time; only the
+// adjacency arrays are freed per vertex. Does nothing if g is NULL.
 void graph_destroy(Graph *g)
 {
     if (!g) return;
-    Vertex *v = g->v_head;
-    while (v) {
-        AdjNode *a = v->adj;
-        while (a) {
-            AdjNode *tmpa = a;
-            a = a->next;
-            free(tmpa);
-        }
-        Vertex *tmpv = v;
-        v = v->next;
-        free(tmpv);
-    }
+    for (size_t id = 0; id < g->v_count; ++id)
+        free(g->by_id[id]->adj);
+    slab_free(&g->vertices);
+    free(g->index);
+    free(g->by_id);
+    free(g->uf_parent);
+    free(g->uf_rank);
+    free(g->pending);
+    arena_free(&g->names);
     free(g);
 }
 
+// Helper: Create, index and link a vertex whose name is valid and new.
+// In bulk mode the vertex is not linked into the sorted list; graph_bulk_commit
+// sorts all such vertices in one pass instead.
+static Vertex *vertex_add(Graph *g, const char *name, uint64_t h)
+{
+    if (g->v_count == GRAPH_NO_VERTEX) return NULL;    // Id space exhausted
+    if (g->v_count == g->by_id_cap && !id_tables_grow(g)) return NULL;
+
+    // Intern the name only now that it is known to be new; if a later step
+    // fails, the few arena bytes stay unused until graph_destroy.
+    const char *handle = arena_intern(&g->names, name, strlen(name));
+    if (!handle) return NULL;
+    Vertex *v_new = vertex_create(g, handle);
+    if (!v_new) return NULL;
+    if (!index_insert(g, v_new, h)) { slab_release(&g->vertices, v_new); return NULL; }
+    v_new->id = (VertexId)g->v_count;
+    g->by_id[v_new->id] = v_new;
+    g->uf_parent[v_new->id] = v_new->id;  // New vertex: its own component
+    g->uf_rank[v_new->id] = 0;
+    g->v_count++;
+    if (g->bulk) return v_new;
+
+    // Names arriving in sorted order append at the tail in O(1);
+    // anything else walks the list to its sorted position.
+    if (!g->v_tail || strcmp(g->v_tail->name, name) < 0) {
+        if (g->v_tail) g->v_tail->next = v_new;
+        else           g->v_head = v_new;
+        g->v_tail = v_new;
+    } else {
+        vertex_list_insert(&g->v_head, v_new);
+    }
+    return v_new;
+}
+
 // Add a new vertex with the given name.
 // Returns true if successful; false for invalid names or duplicates.
 bool graph_add_vertex(Graph *g, const char *name)
 {
     if (!g || !is_valid_name(name)) return false;
-    // Check if vertex already exists
-    Vertex *cursor = g->v_head;
-    while (cursor && strcmp(cursor->name, name) < 0) cursor = cursor->next;
-    if (cursor && strcmp(cursor->name, name) == 0) return false;
-
-    Vertex *v_new = vertex_create(name);
-    if (!v_new) return false;
-    vertex_list_insert(&g->v_head, v_new);
-    g->v_count++;
-    return true;
+    // Check if vertex already exists (hash index lookup)
+    uint64_t h = name_hash(name);
+    if (g->index_cap && index_probe(g, name, h)->v) return false;
+    return vertex_add(g, name, h) != NULL;
 }
 
 // Helper: Find a vertex in the graph by name (returns NULL if not found)
 static Vertex *graph_find_vertex(const Graph *g, const char *name)
 {
-    const Vertex *v = g->v_head;
-    while (v && strcmp(v->name, name) < 0) v = v->next;
-    return (v && strcmp(v->name, name) == 0) ? (Vertex *)v : NULL;
+    if (!g || !name || !g->index_cap) return NULL;
+    return index_probe(g, name, name_hash(name))->v;
+}
+
+// Helper: Find a vertex by id (returns NULL if the id is not in use)
+static Vertex *graph_vertex_at(const Graph *g, VertexId id)
+{
+    return (g && id < g->v_count) ? g->by_id[id] : NULL;
+}
+
+// Helper: Buffer one validated edge (bulk mode).
+static bool bulk_push(Graph *g, VertexId u, VertexId v, int weight)
+{
+    if (g->pending_len == g->pending_cap) {
+        if (g->pending_cap >= UINT32_MAX / 2) return false;  // seq must fit 32 bits
+        size_t new_cap = g->pending_cap ? g->pending_cap * 2 : INDEX_MIN_CAP;
+        BulkEdge *grown = realloc(g->pending, new_cap * sizeof(BulkEdge));
+        if (!grown) return false;
+        g->pending = grown;
+        g->pending_cap = new_cap;
+    }
+    g->pending[g->pending_len++] = (BulkEdge){ u, v, weight };
+    return true;
 }
 
 // Add or update an undirected edge between u and v with the given weight.
@@ -213,26 +576,230 @@ static Vertex *graph_find_vertex(const Graph *g, const char *name)
 bool graph_add_edge(Graph *g, const char *u_name, const char *v_name, int weight)
 {
     if (!g || !is_valid_name(u_name) || !is_valid_name(v_name)) return false;
-    if (strcmp(u_name, v_name) == 0) return false;         // No self-loops allowed
-    if (weight < MIN_WEIGHT || weight > MAX_WEIGHT) return false;
-
     Vertex *u = graph_find_vertex(g, u_name);
     Vertex *v = graph_find_vertex(g, v_name);
     if (!u || !v) return false;
+    return graph_add_edge_id(g, u->id, v->id, weight);
+}
+
+// ID variant of graph_add_edge: same rules, no name resolution.
+bool graph_add_edge_id(Graph *g, VertexId u_id, VertexId v_id, int weight)
+{
+    if (u_id == v_id) return false;                        // No self-loops allowed
+    if (weight < MIN_WEIGHT || weight > MAX_WEIGHT) return false;
+
+    Vertex *u = graph_vertex_at(g, u_id);
+    Vertex *v = graph_vertex_at(g, v_id);
+    if (!u || !v) return false;
+    if (g->bulk) return bulk_push(g, u_id, v_id, weight);
+
+    // Existing edge: update the weight in both directions
+    size_t pos_uv, pos_vu;
+    bool found_uv = adj_search(g, u, v, &pos_uv);
+    bool found_vu = adj_search(g, v, u, &pos_vu);
+    if (found_uv && found_vu) {
+        u->adj[pos_uv].weight = weight;
+        v->adj[pos_vu].weight = weight;
+        return true;
+    }
+
+    // New edge: insert into both arrays at their sorted positions (undirected)
+    if (!adj_insert(u, pos_uv, v_id, weight)) return false;
+    if (!adj_insert(v, pos_vu, u_id, weight)) {
+        // Roll back the first half so the graph stays symmetric
+        memmove(&u->adj[pos_uv], &u->adj[pos_uv + 1], (u->deg - pos_uv - 1) * sizeof(AdjEntry));
+        u->deg--;
+        return false;
+    }
+    g->e_count++;
+    uf_union(g, u_id, v_id);
+    return true;
+}
+
+// ============================================================================
+// BULK LOADING
+// ----------------------------------------------------------------------------
+// graph_bulk_commit builds everything from the buffered edges in one pass:
+//   1. Vertices added in bulk mode are sorted by name once (qsort) and the
+//      vertex list is relinked; rank[id] is each vertex's lexicographic index.
+//   2. Every buffered edge becomes two arcs, bucketed by source vertex with a
+//      counting sort (stable, so arrival order survives inside each bucket).
+//   3. Each bucket is sorted by (neighbor rank, arrival), and only the last
+//      arc of each run of duplicates is kept (last weight wins).
+//   4. Each adjacency array is grown once and the bucket is merged into it
+//      from the back, in place.
+// All allocation happens before step 4 touches the graph, so an OOM leaves
+// the graph unchanged and still in bulk mode.
+// ============================================================================
+
+// An arc of a bulk bucket: rank orders by name, seq breaks ties by arrival.
+typedef struct BulkArc {
+    uint32_t rank;
+    uint32_t seq;
+    VertexId id;
+    int      weight;
+} BulkArc;
+
+// qsort comparators: vertices by name; arcs by (rank, seq)
+static int cmp_vertex_name(const void *pa, const void *pb)
+{
+    return strcmp((*(Vertex *const *)pa)->name, (*(Vertex *const *)pb)->name);
+}
+
+static int cmp_bulk_arc(const void *pa, const void *pb)
+{
+    const BulkArc *a = pa, *b = pb;
+    if (a->rank != b->rank) return a->rank < b->rank ? -1 : 1;
+    return (a->seq > b->seq) - (a->seq < b->seq);
+}
+
+bool graph_bulk_begin(Graph *g)
+{
+    if (!g || g->bulk) return false;
+    g->bulk = true;
+    g->bulk_first = g->v_count;
+    g->pending_len = 0;
+    return true;
+}
+
+size_t graph_bulk_add_edges(Graph *g, const GraphEdgeSpec *edges, size_t count)
+{
+    if (!g || !g->bulk || !edges) return 0;
+    size_t accepted = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const GraphEdgeSpec *e = &edges[i];
+        if (!is_valid_name(e->u) || !is_valid_name(e->v)) continue;
+        if (e->weight < MIN_WEIGHT || e->weight > MAX_WEIGHT) continue;
+        if (strcmp(e->u, e->v) == 0) continue;            // No self-loops allowed
+
+        // Resolve both endpoints, adding any that are new
+        Vertex *ends[2];
+        const char *names[2] = { e->u, e->v };
+        for (int k = 0; k < 2; ++k) {
+            uint64_t h = name_hash(names[k]);
+            ends[k] = g->index_cap ? index_probe(g, names[k], h)->v : NULL;
+            if (!ends[k]) ends[k] = vertex_add(g, names[k], h);
+        }
+        if (!ends[0] || !ends[1]) continue;
+        if (bulk_push(g, ends[0]->id, ends[1]->id, e->weight)) accepted++;
+    }
+    return accepted;
+}
+
+bool graph_bulk_commit(Graph *g)
+{
+    if (!g || !g->bulk) return false;
+    size_t n = g->v_count, p = g->pending_len;
+
+    // --- Allocate all scratch up front (no graph changes yet) ---
+    Vertex  **order  = malloc((n ? n : 1) * sizeof(Vertex *));
+    uint32_t *rank   = malloc((n ? n : 1) * sizeof(uint32_t));
+    size_t   *start  = calloc(n + 1, sizeof(size_t));
+    size_t   *cursor = malloc((n ? n : 1) * sizeof(size_t));
+    BulkArc  *arcs   = malloc((p ? 2 * p : 1) * sizeof(BulkArc));
+    bool ok = order && rank && start && cursor && arcs;
 
-    // Check if edge already exists before insertion (for e_count logic)
-    bool new_edge = adj_find(u->adj, v_name) == NULL;
+    // --- Step 1: lexicographic order of all vertices ---
+    if (ok) {
+        if (g->v_count > g->bulk_first) {
+            for (size_t i = 0; i < n; ++i) order[i] = g->by_id[i];
+            qsort(order, n, sizeof(Vertex *), cmp_vertex_name);
+        } else {
+            size_t i = 0;
+            for (Vertex *v = g->v_head; v; v = v->next) order[i++] = v;
+        }
+        for (size_t i = 0; i < n; ++i) rank[order[i]->id] = (uint32_t)i;
+    }
+
+    // --- Step 2: bucket arcs by source (counting sort, stable) ---
+    if (ok) {
+        for (size_t i = 0; i < p; ++i) {
+            start[g->pending[i].u + 1]++;
+            start[g->pending[i].v + 1]++;
+        }
+        for (size_t i = 0; i < n; ++i) start[i + 1] += start[i];
+        memcpy(cursor, start, n * sizeof(size_t));
+        for (size_t i = 0; i < p; ++i) {
+            const BulkEdge *e = &g->pending[i];
+            arcs[cursor[e->u]++] = (BulkArc){ rank[e->v], (uint32_t)i, e->v, e->weight };
+            arcs[cursor[e->v]++] = (BulkArc){ rank[e->u], (uint32_t)i, e->u, e->weight };
+        }
+    }
+
+    // --- Step 3: sort and dedupe each bucket; grow each adjacency array ---
+    // cursor[u] becomes the deduplicated bucket length.
+    for (size_t u = 0; ok && u < n; ++u) {
+        BulkArc *row = arcs + start[u];
+        size_t len = start[u + 1] - start[u], kept = 0;
+        if (len == 0) { cursor[u] = 0; continue; }
+        qsort(row, len, sizeof(BulkArc), cmp_bulk_arc);
+        for (size_t i = 0; i < len; ++i) {
+            if (kept && row[kept - 1].rank == row[i].rank) row[kept - 1] = row[i];
+            else                                           row[kept++] = row[i];
+        }
+        cursor[u] = kept;
 
-    // Create adjacency nodes for both directions (undirected)
-    AdjNode *a_uv = adj_create(v, weight);
-    if (!a_uv) return false;
-    AdjNode *a_vu = adj_create(u, weight);
-    if (!a_vu) { free(a_uv); return false; }
+        Vertex *v = g->by_id[u];
+        size_t need = (size_t)v->deg + kept;    // Upper bound (ignores matches)
+        if (need > UINT32_MAX) { ok = false; break; }
+        if (need > v->adj_cap) {
+            AdjEntry *grown = realloc(v->adj, need * sizeof(AdjEntry));
+            if (!grown) { ok = false; break; }
+            v->adj = grown;
+            v->adj_cap = (uint32_t)need;
+        }
+    }
+
+    if (!ok) {
+        free(order); free(rank); free(start); free(cursor); free(arcs);
+        return false;
+    }
+
+    // --- Step 4: relink the vertex list and merge each bucket in place ---
+    if (g->v_count > g->bulk_first) {
+        for (size_t i = 0; i < n; ++i) order[i]->next = (i + 1 < n) ? order[i + 1] : NULL;
+        g->v_head = n ? order[0] : NULL;
+        g->v_tail = n ? order[n - 1] : NULL;
+    }
+    for (size_t u = 0; u < n; ++u) {
+        const BulkArc *row = arcs + start[u];
+        size_t kept = cursor[u];
+        if (kept == 0) continue;
+        Vertex *v = g->by_id[u];
+
+        // Count matches with existing entries to find the final length
+        size_t i = 0, j = 0, matches = 0;
+        while (i < v->deg && j < kept) {
+            uint32_t r = rank[v->adj[i].id];
+            if (r < row[j].rank)      i++;
+            else if (r > row[j].rank) j++;
+            else { matches++; i++; j++; }
+        }
+        size_t total = v->deg + kept - matches;
 
-    // Insert or update in both adjacency lists (keeps lists sorted)
-    adj_list_insert(&u->adj, a_uv);
-    adj_list_insert(&v->adj, a_vu);
-    if (new_edge) g->e_count++;
+        // Merge from the back so existing entries are never overwritten early
+        size_t a = v->deg, b = kept, out = total;
+        while (b > 0) {
+            if (a > 0 && rank[v->adj[a - 1].id] > row[b - 1].rank) {
+                v->adj[--out] = v->adj[--a];
+            } else {
+                if (a > 0 && rank[v->adj[a - 1].id] == row[b - 1].rank) --a; // Replaced
+                else if (u < row[b - 1].id) g->e_count++;                     // New pair
+                --b;
+                v->adj[--out] = (AdjEntry){ row[b].id, row[b].weight };
+            }
+        }
+        v->deg = (uint32_t)total;
+    }
+
+    for (size_t i = 0; i < p; ++i)
+        uf_union(g, g->pending[i].u, g->pending[i].v);
+
+    free(order); free(rank); free(start); free(cursor); free(arcs);
+    free(g->pending);
+    g->pending = NULL;
+    g->pending_len = g->pending_cap = 0;
+    g->bulk = false;
     return true;
 }
 
@@ -241,17 +808,44 @@ bool graph_add_edge(Graph *g, const char *u_name, const char *v_name, int weight
 int graph_get_degree(Graph *g, const char *name)
 {
     Vertex *v = graph_find_vertex(g, name);
-    if (!v) return -1;
-    int deg = 0;
-    for (AdjNode *a = v->adj; a; a = a->next) ++deg;
-    return deg;
+    return v ? graph_get_degree_id(g, v->id) : -1;
+}
+
+// ID variant of graph_get_degree.
+int graph_get_degree_id(const Graph *g, VertexId id)
+{
+    Vertex *v = graph_vertex_at(g, id);
+    return v ? (int)v->deg : -1;
 }
 
 // Check if there is an edge between u and v (returns true if present)
 bool graph_edge_exists(Graph *g, const char *u_name, const char *v_name)
 {
     Vertex *u = graph_find_vertex(g, u_name);
-    return u && adj_find(u->adj, v_name);
+    Vertex *v = graph_find_vertex(g, v_name);
+    return u && v && adj_find_id(g, u, v->id);
+}
+
+// ID variant of graph_edge_exists.
+bool graph_edge_exists_id(const Graph *g, VertexId u_id, VertexId v_id)
+{
+    Vertex *u = graph_vertex_at(g, u_id);
+    return u && adj_find_id(g, u, v_id);
+}
+
+// Check whether u and v are in the same connected component (union-find).
+bool graph_connected(Graph *g, const char *u_name, const char *v_name)
+{
+    Vertex *u = graph_find_vertex(g, u_name);
+    Vertex *v = graph_find_vertex(g, v_name);
+    return u && v && graph_connected_id(g, u->id, v->id);
+}
+
+// ID variant of graph_connected.
+bool graph_connected_id(Graph *g, VertexId u_id, VertexId v_id)
+{
+    if (!graph_vertex_at(g, u_id) || !graph_vertex_at(g, v_id)) return false;
+    return uf_find(g, u_id) == uf_find(g, v_id);
 }
 
 // Check if a vertex with given name exists in the graph
@@ -259,19 +853,72 @@ bool graph_vertex_exists(const Graph* g, const char* name) {
     return graph_find_vertex(g, name) != NULL;
 }
 
+// Resolve a name to its id (GRAPH_NO_VERTEX if absent).
+VertexId graph_vertex_id(const Graph *g, const char *name)
+{
+    Vertex *v = graph_find_vertex(g, name);
+    return v ? v->id : GRAPH_NO_VERTEX;
+}
+
+// Name of the vertex with the given id (NULL if the id is not in use).
+const char *graph_vertex_name(const Graph *g, VertexId id)
+{
+    Vertex *v = graph_vertex_at(g, id);
+    return v ? v->name : NULL;
+}
+
 // Retrieve the names of all neighbors of the named vertex (in sorted order).
 // Returns the number of neighbors found, or -1 if vertex does not exist.
 size_t graph_get_neighbors(const Graph* g, const char* name, char neighbors[][MAX_NAME_LEN]) {
     Vertex* v = graph_find_vertex(g, name);
     if (!v) return -1;
 
-    int count = 0;
-    for (AdjNode* a = v->adj; a; a = a->next) {
-        strncpy(neighbors[count], a->dst->name, MAX_NAME_LEN);
-        neighbors[count][MAX_NAME_LEN - 1] = '\0';
-        count++;
+    for (uint32_t i = 0; i < v->deg; ++i)
+        name_copy(neighbors[i], g->by_id[v->adj[i].id]->name);
+    return v->deg;
+}
+
+// ID variant of graph_get_neighbors: neighbor ids (and optionally weights)
+// in lexicographic order of the neighbors' names.
+size_t graph_get_neighbor_ids(const Graph *g, VertexId id, VertexId *out, int *weights)
+{
+    Vertex *v = graph_vertex_at(g, id);
+    if (!v) return (size_t)-1;
+
+    for (uint32_t i = 0; i < v->deg; ++i) {
+        out[i] = v->adj[i].id;
+        if (weights) weights[i] = v->adj[i].weight;
     }
-    return count;
+    return v->deg;
+}
+
+// Traversal view (graph_internal.h): ids are dense, so the bound is v_count.
+size_t graph_index_bound(const Graph *g)
+{
+    return g ? g->v_count : 0;
+}
+
+// Traversal view: a vertex's adjacency array as (pointer, length).
+GraphAdjSpan graph_adj_span(const Graph *g, VertexId id)
+{
+    Vertex *v = graph_vertex_at(g, id);
+    if (!v || !v->deg) return (GraphAdjSpan){ NULL, 0 };
+    return (GraphAdjSpan){ v->adj, v->deg };
+}
+
+// Start a zero-copy walk over the neighbors of vertex 'id'.
+bool graph_neighbors_begin(const Graph *g, VertexId id, GraphNeighborIter *it)
+{
+    GraphAdjSpan span = graph_adj_span(g, id);
+    it->pos = span.adj;
+    it->end = span.deg ? span.adj + span.deg : span.adj;
+    return graph_vertex_at(g, id) != NULL;
+}
+
+// Yield the next neighbor entry, or NULL at the end.
+const GraphNeighbor *graph_neighbors_next(GraphNeighborIter *it)
+{
+    return it->pos != it->end ? it->pos++ : NULL;
 }
 
 // ============================================================================
@@ -298,24 +945,132 @@ void edge_check(Graph *g, const char *u_name, const char *v_name) {
 
 // Retrieve all vertex names in the graph, in sorted order.
 // Returns the number of vertices found.
-int graph_get_all_vertices(Graph *g, char names[][256]) {
+int graph_get_all_vertices(Graph *g, char names[][MAX_NAME_LEN]) {
     if (!g) return 0;
     int count = 0;
     Vertex *v = g->v_head;
     while (v) {
-        strncpy(names[count++], v->name, 256);
+        name_copy(names[count++], v->name);
         v = v->next;
     }
     return count;
 }
 
+// Number of vertices in the graph.
+size_t graph_vertex_count(const Graph *g) {
+    return g ? g->v_count : 0;
+}
+
+// Borrow pointers to all vertex names, in sorted order (no copies).
+size_t graph_get_vertex_names(const Graph *g, const char **names) {
+    if (!g || !names) return 0;
+    size_t count = 0;
+    for (const Vertex *v = g->v_head; v; v = v->next)
+        names[count++] = v->name;
+    return count;
+}
+
+// Borrow pointers to all vertex names, indexed by vertex id (no copies).
+size_t graph_get_names_by_id(const Graph *g, const char **names) {
+    if (!g || !names) return 0;
+    for (size_t id = 0; id < g->v_count; ++id)
+        names[id] = g->by_id[id]->name;
+    return g->v_count;
+}
+
+// Fill 'ids' with every vertex id, in lexicographic order of the names.
+size_t graph_get_vertex_ids(const Graph *g, VertexId *ids) {
+    if (!g || !ids) return 0;
+    size_t count = 0;
+    for (const Vertex *v = g->v_head; v; v = v->next)
+        ids[count++] = v->id;
+    return count;
+}
+
 // Return the weight of the edge between u and v, or -1 if no such edge exists.
 int graph_get_edge_weight(Graph *g, const char *u_name, const char *v_name) {
     Vertex *u = graph_find_vertex(g, u_name);
+    Vertex *v = graph_find_vertex(g, v_name);
+    return (u && v) ? graph_get_edge_weight_id(g, u->id, v->id) : -1;
+}
+
+// ID variant of graph_get_edge_weight.
+int graph_get_edge_weight_id(const Graph *g, VertexId u_id, VertexId v_id) {
+    Vertex *u = graph_vertex_at(g, u_id);
     if (!u) return -1;
-    for (AdjNode *a = u->adj; a; a = a->next) {
-        if (strcmp(a->dst->name, v_name) == 0)
-            return a->weight;
+    AdjEntry *a = adj_find_id(g, u, v_id);
+    return a ? a->weight : -1;
+}
+
+// ============================================================================
+// CSR SNAPSHOT
+// ----------------------------------------------------------------------------
+// Two passes over the sorted vertex list: the first numbers vertices
+// (rank[id] = lexicographic index), the second copies each adjacency array
+// into its row. Arrays are sorted by name, so rows come out sorted by index.
+// ============================================================================
+GraphCSR *graph_freeze(const Graph *g)
+{
+    if (!g) return NULL;
+    size_t n = g->v_count, m = 2 * g->e_count;
+    GraphCSR *csr = calloc(1, sizeof(GraphCSR));
+    if (!csr) return NULL;
+    csr->n = n;
+    csr->m = m;
+    csr->offsets = malloc((n + 1) * sizeof(size_t));
+    csr->adj     = malloc((m ? m : 1) * sizeof(uint32_t));
+    csr->weights = malloc((m ? m : 1) * sizeof(int));
+    csr->names   = malloc((n ? n : 1) * sizeof(const char *));
+    uint32_t *rank = malloc((n ? n : 1) * sizeof(uint32_t));
+    if (!csr->offsets || !csr->adj || !csr->weights || !csr->names || !rank) {
+        free(rank);
+        graph_csr_destroy(csr);
+        return NULL;
+    }
+
+    size_t i = 0;
+    for (const Vertex *v = g->v_head; v; v = v->next) {
+        rank[v->id] = (uint32_t)i;
+        csr->names[i++] = v->name;
+    }
+
+    size_t k = 0;
+    i = 0;
+    for (const Vertex *v = g->v_head; v; v = v->next) {
+        csr->offsets[i++] = k;
+        for (uint32_t j = 0; j < v->deg; ++j, ++k) {
+            csr->adj[k]     = rank[v->adj[j].id];
+            csr->weights[k] = v->adj[j].weight;
+        }
+    }
+    csr->offsets[n] = k;
+    free(rank);
+    return csr;
+}
+
+// Free all arrays of a snapshot (names are borrowed, only the array is freed).
+// Mapped snapshots are released by graph_file.c, which owns the mapping.
+void graph_csr_destroy(GraphCSR *csr)
+{
+    if (!csr) return;
+    if (csr->mapping) { graph_csr_unmap(csr); return; }
+    free(csr->offsets);
+    free(csr->adj);
+    free(csr->weights);
+    free(csr->names);
+    free(csr);
+}
+
+// Binary search over the snapshot's sorted names.
+long graph_csr_index_of(const GraphCSR *csr, const char *name)
+{
+    if (!csr || !name) return -1;
+    size_t lo = 0, hi = csr->n;
+    while (lo < hi) {
+        size_t mid = (lo + hi) >> 1;
+        int cmp = strcmp(csr->names[mid], name);
+        if (cmp == 0) return (long)mid;
+        (cmp < 0) ? (lo = mid + 1) : (hi = mid);
     }
     return -1;
 }
@@ -348,12 +1103,12 @@ static void print_edges(const Graph *g)
     const Vertex *u = g->v_head;
     bool first = true;
     while (u) {
-        for (AdjNode *a = u->adj; a; a = a->next) {
-            const char *v_name = a->dst->name;
+        for (uint32_t i = 0; i < u->deg; ++i) {
+            const char *v_name = g->by_id[u->adj[i].id]->name;
             if (strcmp(u->name, v_name) < 0) { // Only print (u, v) when u < v
                 if (!first) printf(",\n");
                 first = false;
-                printf("(%s, %s, %d)", u->name, v_name, a->weight);
+                printf("(%s, %s, %d)", u->name, v_name, u->adj[i].weight);
             }
         }
         u = u->next;
@@ -24,7 +24,6 @@
 #ifndef GRAPH_H
 #define GRAPH_H
 
-#define MAX_VERTICES 100     // Maximum number of vertices supported (API-wide)
 #define MAX_NAME_LEN 256     // Max allowed length for vertex names (for buffers/validation)
 
 #ifdef __cplusplus
@@ -33,6 +32,7 @@ extern "C" {
 
 #include <stdbool.h>
 #include <stddef.h>  // For size_t
+#include <stdint.h>  // For uint32_t (CSR neighbor indices)
 
 /* ─────────────────────────────────────────────────────────────────────────────
  *  OPAQUE GRAPH TYPE
@@ -44,6 +44,17 @@ extern "C" {
  * ───────────────────────────────────────────────────────────────────────────*/
 typedef struct Graph Graph;  // Opaque type, actual fields in graph.c
 
+/* ─────────────────────────────────────────────────────────────────────────────
+ *  VERTEX IDS
+ *  ---------------------------------------------------------------------------
+ *  Every vertex gets a dense integer id when it is added: 0, 1, 2, ... in
+ *  insertion order. Ids never change, so callers can resolve a name once
+ *  (graph_vertex_id) and use the *_id functions below in hot loops without
+ *  any string work. GRAPH_NO_VERTEX marks "no such vertex".
+ * ───────────────────────────────────────────────────────────────────────────*/
+typedef uint32_t VertexId;
+#define GRAPH_NO_VERTEX UINT32_MAX
+
 /* ─────────────────────────────────────────────────────────────────────────────
  *  LIFECYCLE FUNCTIONS
  *  ---------------------------------------------------------------------------
@@ -73,6 +84,47 @@ bool graph_add_vertex(Graph *g, const char *name);
 // Returns false if either vertex is missing, if weight is out of range, or OOM.
 bool graph_add_edge(Graph *g, const char *u_name, const char *v_name, int weight);
 
+// ID variant of graph_add_edge (same rules; ids from graph_vertex_id).
+bool graph_add_edge_id(Graph *g, VertexId u, VertexId v, int weight);
+
+/* ─────────────────────────────────────────────────────────────────────────────
+ *  BULK LOADING
+ *  ---------------------------------------------------------------------------
+ *  Loading a large edge list one graph_add_edge at a time keeps every list
+ *  sorted after each insertion. The bulk loader instead buffers edges and
+ *  builds the sorted structures once:
+ *
+ *      graph_bulk_begin(g);
+ *      graph_bulk_add_edges(g, batch, count);   // any number of batches
+ *      graph_bulk_commit(g);                    // one O(V log V + E log E) pass
+ *
+ *  - Edges may arrive in any order; endpoints that are not vertices yet are
+ *    added automatically. Invalid entries (bad names, self-loops, weights
+ *    outside 1–100) are skipped.
+ *  - Duplicates follow graph_add_edge: the last weight wins, including over
+ *    edges that were already in the graph before graph_bulk_begin.
+ *  - Between begin and commit, graph_add_vertex and graph_add_edge(_id) are
+ *    buffered the same way. Nothing else may be called on the graph until
+ *    graph_bulk_commit (other than graph_destroy).
+ * ───────────────────────────────────────────────────────────────────────────*/
+// One edge of a bulk batch; names are only read during graph_bulk_add_edges.
+typedef struct GraphEdgeSpec {
+    const char *u;
+    const char *v;
+    int         weight;
+} GraphEdgeSpec;
+
+// Enter bulk mode. Returns false if g is NULL or already in bulk mode.
+bool graph_bulk_begin(Graph *g);
+
+// Buffer 'count' edges. Returns how many were accepted (invalid ones are skipped).
+size_t graph_bulk_add_edges(Graph *g, const GraphEdgeSpec *edges, size_t count);
+
+// Merge all buffered vertices and edges into the sorted structures and leave
+// bulk mode. Returns false on OOM, in which case the graph stays in bulk mode
+// with everything still buffered, so the commit can be retried.
+bool graph_bulk_commit(Graph *g);
+
 /* ─────────────────────────────────────────────────────────────────────────────
  *  QUERY COMMANDS (Cmd 3 & 4)
  *  ---------------------------------------------------------------------------
@@ -87,6 +139,20 @@ int graph_get_degree(Graph *g, const char *name);
 // Check if an edge (u, v) exists in the graph (undirected).
 bool graph_edge_exists(Graph *g, const char *u_name, const char *v_name);
 
+// ID variants of graph_get_degree / graph_edge_exists.
+int  graph_get_degree_id(const Graph *g, VertexId id);
+bool graph_edge_exists_id(const Graph *g, VertexId u, VertexId v);
+
+// Check whether any path joins u and v (same connected component).
+// The graph keeps a union-find index updated on every edge insertion, so this
+// is a near-constant-time lookup rather than a search. It compresses paths in
+// that index, hence the non-const Graph. A vertex is connected to itself;
+// returns false if either vertex does not exist.
+bool graph_connected(Graph *g, const char *u_name, const char *v_name);
+
+// ID variant of graph_connected.
+bool graph_connected_id(Graph *g, VertexId u, VertexId v);
+
 // Command 3: Print the degree of a vertex (prints nothing if invalid)
 void get_degree(Graph *g, const char *name);
 
@@ -98,20 +164,147 @@ void edge_check(Graph *g, const char *u_name, const char *v_name);
  *  ---------------------------------------------------------------------------
  *  These support traversal, visualization, or advanced queries.
  * ───────────────────────────────────────────────────────────────────────────*/
-// Get all neighbors of a vertex. Fills 'neighbors' array with up to MAX_VERTICES
-// names (strings, each up to MAX_NAME_LEN). Returns the neighbor count, or -1 if missing.
+// Get all neighbors of a vertex. Fills 'neighbors' array with the neighbor names
+// (strings, each up to MAX_NAME_LEN); the caller sizes it with graph_get_degree().
+// Returns the neighbor count, or -1 if missing.
 size_t graph_get_neighbors(const Graph *g, const char *name, char neighbors[][MAX_NAME_LEN]);
 
 // Returns true if the vertex with 'name' exists in the graph, else false.
 bool graph_vertex_exists(const Graph *g, const char *name);
 
 // Fills 'names' array with all vertex names (each string up to MAX_NAME_LEN).
-// Returns the total number of vertices found.
+// The caller sizes it with graph_vertex_count(). Returns the number of vertices found.
 int graph_get_all_vertices(Graph *g, char names[][MAX_NAME_LEN]);
 
+// Number of vertices currently in the graph (0 for NULL).
+size_t graph_vertex_count(const Graph *g);
+
+// Fills 'names' with pointers to every vertex name, in sorted order, without
+// copying. The strings belong to the graph and stay valid until graph_destroy().
+// 'names' must hold graph_vertex_count() entries. Returns the number written.
+size_t graph_get_vertex_names(const Graph *g, const char **names);
+
 // Returns the weight of the edge between u and v, or -1 if no such edge exists.
 int graph_get_edge_weight(Graph *g, const char *u, const char *v);
 
+// Resolve a vertex name to its id, or GRAPH_NO_VERTEX if it does not exist. O(1).
+VertexId graph_vertex_id(const Graph *g, const char *name);
+
+// Name of vertex 'id' (owned by the graph), or NULL for an unused id. O(1).
+const char *graph_vertex_name(const Graph *g, VertexId id);
+
+// ID variant of graph_get_edge_weight (-1 if no such edge).
+int graph_get_edge_weight_id(const Graph *g, VertexId u, VertexId v);
+
+// ID variant of graph_get_neighbors: fills 'out' with neighbor ids (and
+// 'weights', if not NULL) in lexicographic order of the neighbor names.
+// Buffers must hold graph_get_degree_id() entries. Returns the count, or -1.
+size_t graph_get_neighbor_ids(const Graph *g, VertexId id, VertexId *out, int *weights);
+
+/* ─────────────────────────────────────────────────────────────────────────────
+ *  NEIGHBOR ITERATION (zero-copy)
+ *  ---------------------------------------------------------------------------
+ *  Walks a vertex's adjacency array in place: each step yields a pointer to
+ *  the graph's own (id, weight) entry, in lexicographic order of the neighbor
+ *  names, with no copying and no allocation.
+ *
+ *      GraphNeighborIter it;
+ *      graph_neighbors_begin(g, id, &it);
+ *      for (const GraphNeighbor *nb; (nb = graph_neighbors_next(&it)); )
+ *          visit(nb->id, nb->weight);
+ *
+ *  The iterator borrows the adjacency array: adding or removing an edge at
+ *  that vertex (or destroying the graph) invalidates it.
+ * ───────────────────────────────────────────────────────────────────────────*/
+typedef struct GraphNeighbor {
+    VertexId id;          // Neighbor's vertex id
+    int      weight;      // Weight of the edge to it
+} GraphNeighbor;
+
+typedef struct GraphNeighborIter {
+    const GraphNeighbor *pos;   // Next entry to yield
+    const GraphNeighbor *end;   // One past the last entry
+} GraphNeighborIter;
+
+// Point 'it' at the neighbors of vertex 'id'. Returns false (and leaves an
+// empty iterator) if the vertex does not exist.
+bool graph_neighbors_begin(const Graph *g, VertexId id, GraphNeighborIter *it);
+
+// Next neighbor of the walk, or NULL once the neighbors are exhausted.
+const GraphNeighbor *graph_neighbors_next(GraphNeighborIter *it);
+
+// Fills 'names[id]' with the name of every vertex (borrowed, no copies);
+// 'names' must hold graph_vertex_count() entries. Returns the number written.
+size_t graph_get_names_by_id(const Graph *g, const char **names);
+
+// Fills 'ids' with every vertex id in lexicographic order of the names;
+// 'ids' must hold graph_vertex_count() entries. Returns the number written.
+size_t graph_get_vertex_ids(const Graph *g, VertexId *ids);
+
+/* ─────────────────────────────────────────────────────────────────────────────
+ *  CSR SNAPSHOT (read-only view for traversals and path algorithms)
+ *  ---------------------------------------------------------------------------
+ *  graph_freeze() copies the current graph into compressed-sparse-row form:
+ *  three contiguous arrays instead of pointer-chasing linked lists.
+ *    - Vertices are numbered 0..n-1 in lexicographic order (same as graph_print)
+ *    - Neighbors of vertex i are adj[offsets[i] .. offsets[i+1]-1], ascending,
+ *      with weights[k] the weight of the edge to adj[k]
+ *    - Every undirected edge appears twice (once per endpoint), so m = 2·|E|
+ *    - Weights are 1..100: graph_add_edge rejects any other, and
+ *      graph_open_mmap refuses a file holding one
+ *  The snapshot does not follow later graph changes; free and re-freeze after
+ *  adding vertices or edges. names[] point into the graph, so the snapshot must
+ *  not outlive it. Snapshots can also be saved to and mapped from a file (see
+ *  GRAPH FILES below); those own their storage and outlive any graph.
+ * ───────────────────────────────────────────────────────────────────────────*/
+typedef struct GraphCSR {
+    size_t       n;        // Number of vertices
+    size_t       m;        // Number of adjacency entries (2 × undirected edges)
+    size_t      *offsets;  // n + 1 row offsets into adj/weights
+    uint32_t    *adj;      // Neighbor indices, sorted within each row
+    int         *weights;  // Edge weights, parallel to adj
+    const char **names;    // names[i] = name of vertex i (borrowed from graph or file)
+    void        *mapping;  // File mapping behind the arrays (graph_open_mmap), else NULL
+    size_t       mapping_len; // Length of the mapping in bytes
+} GraphCSR;
+
+// Build a CSR snapshot of g in O(V + E). Returns NULL on NULL input or OOM.
+GraphCSR *graph_freeze(const Graph *g);
+
+// Free a snapshot from graph_freeze() or graph_open_mmap(). Safe to call on NULL.
+void graph_csr_destroy(GraphCSR *csr);
+
+// Index of the vertex called 'name' (binary search), or -1 if absent.
+long graph_csr_index_of(const GraphCSR *csr, const char *name);
+
+/* ─────────────────────────────────────────────────────────────────────────────
+ *  GRAPH FILES (graph_file.c)
+ *  ---------------------------------------------------------------------------
+ *  A versioned binary file holding a CSR snapshot: header, name table, row
+ *  offsets, neighbors and weights, each section 8-byte aligned. Files use the
+ *  native byte order and are rejected on a machine with a different one.
+ *
+ *  graph_open_mmap() maps the file read-only and returns a GraphCSR whose
+ *  offsets/adj/weights/names point directly into the mapped pages (only the
+ *  names[] pointer table is allocated), so every *_csr algorithm runs on the
+ *  file without copying it. Opening reads the adjacency once to validate it
+ *  (indices, symmetry, weights), so the engines can index by adj[k] safely.
+ *  Free it with graph_csr_destroy().
+ * ───────────────────────────────────────────────────────────────────────────*/
+// Write the current graph to 'path'. Returns false on OOM or I/O error.
+bool graph_save(const Graph *g, const char *path);
+
+// Write an existing snapshot (frozen or mapped) to 'path'.
+bool graph_csr_save(const GraphCSR *csr, const char *path);
+
+// Map a graph file read-only. Returns NULL if it is missing, malformed
+// (including neighbor indices out of range, unsorted or one-directional rows,
+// and weights outside 1..100), from another byte order, or on OOM.
+GraphCSR *graph_open_mmap(const char *path);
+
+// Release a mapped snapshot; graph_csr_destroy() calls this, use that instead.
+void graph_csr_unmap(GraphCSR *csr);
+
 /* ─────────────────────────────────────────────────────────────────────────────
  *  OUTPUT (Cmd 10)
  *  ---------------------------------------------------------------------------
@@ -0,0 +1,269 @@
+// ============================================================================
+// FILE: graph_file.c  – Binary graph file format (save + read-only mmap)
+// ----------------------------------------------------------------------------
+// Persists a graph as its CSR snapshot so it can be reopened without replaying
+// text commands. graph_open_mmap() maps the file read-only and points the
+// snapshot's arrays straight at the mapped pages; the only work done on open
+// is validating the sections and building the names[] pointer table.
+//
+// File layout (version 1, native byte order, every section 8-byte aligned):
+//
+//   GraphFileHeader                     fixed size, see below
+//   name table    names_len bytes       n NUL-terminated names, lex order
+//   offsets       (n + 1) × uint64_t    row offsets (offsets[n] == m)
+//   adj           m × uint32_t          neighbor indices, sorted per row
+//   weights       m × int32_t           edge weights, parallel to adj
+//
+// The header records a byte-order marker and the size of every section, so a
+// file from another architecture or a truncated file is rejected on open.
+// ============================================================================
+
+#define _POSIX_C_SOURCE 200809L   // open/fstat/mmap under -std=c11
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "graph.h"
+
+// ============================================================================
+// CONSTANTS AND HEADER
+// ============================================================================
+#define GRAPH_FILE_MAGIC   "MCO2GRF"   // 7 chars + NUL = 8 bytes
+#define GRAPH_FILE_VERSION 1u
+#define GRAPH_FILE_ENDIAN  0x01020304u // Reads back differently on a foreign byte order
+#define GRAPH_FILE_MIN_WEIGHT 1        // Weight range graph_add_edge accepts
+#define GRAPH_FILE_MAX_WEIGHT 100
+
+typedef struct GraphFileHeader {
+    char     magic[8];     // GRAPH_FILE_MAGIC
+    uint32_t version;      // GRAPH_FILE_VERSION
+    uint32_t endian;       // GRAPH_FILE_ENDIAN
+    uint64_t n;            // Vertex count
+    uint64_t m;            // Adjacency entries (2 × undirected edges)
+    uint64_t names_off;    // Byte offset of the name table
+    uint64_t names_len;    // Byte length of the name table
+    uint64_t offsets_off;  // Byte offset of the row offsets
+    uint64_t adj_off;      // Byte offset of the neighbor indices
+    uint64_t weights_off;  // Byte offset of the weights
+    uint64_t file_len;     // Total file size in bytes
+} GraphFileHeader;
+
+// Round up to the next multiple of 8 (section alignment).
+static uint64_t align8(uint64_t x) { return (x + 7u) & ~(uint64_t)7u; }
+
+// Write 'pad' zero bytes (fewer than 8).
+static bool write_pad(FILE *f, uint64_t pad)
+{
+    static const char zeros[8] = { 0 };
+    return pad == 0 || fwrite(zeros, 1, (size_t)pad, f) == pad;
+}
+
+// ============================================================================
+// SAVE
+// ============================================================================
+
+// Write a snapshot to 'path' (created or truncated). Returns false on I/O error.
+bool graph_csr_save(const GraphCSR *csr, const char *path)
+{
+    if (!csr || !path) return false;
+
+    // --- Lay out the sections ---
+    GraphFileHeader h;
+    memset(&h, 0, sizeof h);
+    memcpy(h.magic, GRAPH_FILE_MAGIC, sizeof h.magic);
+    h.version = GRAPH_FILE_VERSION;
+    h.endian  = GRAPH_FILE_ENDIAN;
+    h.n = csr->n;
+    h.m = csr->m;
+    h.names_off = align8(sizeof h);
+    for (size_t i = 0; i < csr->n; ++i)
+        h.names_len += strlen(csr->names[i]) + 1;
+    h.offsets_off = align8(h.names_off + h.names_len);
+    h.adj_off     = h.offsets_off + (h.n + 1) * sizeof(uint64_t);
+    h.weights_off = align8(h.adj_off + h.m * sizeof(uint32_t));
+    h.file_len    = h.weights_off + h.m * sizeof(int32_t);
+
+    FILE *f = fopen(path, "wb");
+    if (!f) return false;
+
+    // --- Header and name table ---
+    bool ok = fwrite(&h, sizeof h, 1, f) == 1 &&
+              write_pad(f, h.names_off - sizeof h);
+    for (size_t i = 0; ok && i < csr->n; ++i)
+        ok = fwrite(csr->names[i], strlen(csr->names[i]) + 1, 1, f) == 1;
+    ok = ok && write_pad(f, h.offsets_off - (h.names_off + h.names_len));
+
+    // --- Row offsets (widened to 64 bits), neighbors, weights ---
+    for (size_t i = 0; ok && i <= csr->n; ++i) {
+        uint64_t off = csr->offsets[i];
+        ok = fwrite(&off, sizeof off, 1, f) == 1;
+    }
+    ok = ok && (csr->m == 0 || fwrite(csr->adj, sizeof(uint32_t), csr->m, f) == csr->m);
+    ok = ok && write_pad(f, h.weights_off - (h.adj_off + h.m * sizeof(uint32_t)));
+    for (size_t k = 0; ok && k < csr->m; ++k) {
+        int32_t w = csr->weights[k];
+        ok = fwrite(&w, sizeof w, 1, f) == 1;
+    }
+
+    if (fclose(f) != 0) ok = false;
+    if (!ok) remove(path);
+    return ok;
+}
+
+// Freeze g and write it to 'path'. Returns false on OOM or I/O error.
+bool graph_save(const Graph *g, const char *path)
+{
+    GraphCSR *csr = graph_freeze(g);
+    if (!csr) return false;
+    bool ok = graph_csr_save(csr, path);
+    graph_csr_destroy(csr);
+    return ok;
+}
+
+// ============================================================================
+// OPEN (read-only mapping)
+// ----------------------------------------------------------------------------
+// Checks, in order: header fields, section bounds against the file size, row
+// offsets (start at 0, non-decreasing, end at m), the name table (n
+// NUL-terminated names in strictly increasing order, so binary search works),
+// and the adjacency (adj_valid below). Every *_csr engine indexes its
+// per-vertex arrays by adj[k], so a neighbor index out of range or a
+// one-directional row would turn a corrupt file into out-of-bounds writes.
+// ============================================================================
+static bool header_valid(const GraphFileHeader *h, uint64_t size)
+{
+    if (memcmp(h->magic, GRAPH_FILE_MAGIC, sizeof h->magic) != 0) return false;
+    if (h->version != GRAPH_FILE_VERSION || h->endian != GRAPH_FILE_ENDIAN) return false;
+    if (h->file_len != size) return false;
+    if (h->n >= UINT32_MAX || h->m > SIZE_MAX / sizeof(int32_t)) return false;
+    if (h->names_off < sizeof *h || h->names_off > size ||
+        h->names_len > size - h->names_off) return false;
+    if (h->offsets_off % 8 || h->offsets_off < h->names_off + h->names_len ||
+        h->offsets_off > size || (size - h->offsets_off) / sizeof(uint64_t) < h->n + 1)
+        return false;
+    if (h->adj_off != h->offsets_off + (h->n + 1) * sizeof(uint64_t) ||
+        (size - h->adj_off) / sizeof(uint32_t) < h->m) return false;
+    if (h->weights_off % 8 || h->weights_off < h->adj_off + h->m * sizeof(uint32_t) ||
+        h->weights_off > size || (size - h->weights_off) / sizeof(int32_t) < h->m)
+        return false;
+    return true;
+}
+
+// One sequential pass over adj and weights. Each row must be strictly
+// ascending with indices below n and no self-loop, and every weight in
+// MIN_WEIGHT..MAX_WEIGHT. Symmetry: rows are visited in increasing u, so the
+// entries u -> v of a fixed v arrive in increasing u, i.e. in the order of
+// v's own (sorted) row. cursor[v] walks that row along with them; every
+// entry u -> v (w) must meet v -> u (w) at the cursor, and every cursor must
+// end at its row's end. O(n + m) with one offset per vertex of scratch;
+// false on OOM as well.
+static bool adj_valid(const uint64_t *offsets, const uint32_t *adj,
+                      const int32_t *weights, uint64_t n)
+{
+    uint64_t *cursor = malloc((n ? n : 1) * sizeof(uint64_t));
+    if (!cursor) return false;
+    memcpy(cursor, offsets, n * sizeof(uint64_t));
+
+    bool ok = true;
+    for (uint64_t u = 0; ok && u < n; ++u) {
+        for (uint64_t k = offsets[u]; k < offsets[u + 1]; ++k) {
+            uint32_t v = adj[k];
+            if (v >= n || v == u || (k > offsets[u] && adj[k - 1] >= v) ||
+                weights[k] < GRAPH_FILE_MIN_WEIGHT || weights[k] > GRAPH_FILE_MAX_WEIGHT) {
+                ok = false;
+                break;
+            }
+            uint64_t c = cursor[v]++;
+            if (c == offsets[v + 1] || adj[c] != u || weights[c] != weights[k]) {
+                ok = false;
+                break;
+            }
+        }
+    }
+    for (uint64_t v = 0; ok && v < n; ++v)
+        if (cursor[v] != offsets[v + 1]) ok = false;
+    free(cursor);
+    return ok;
+}
+
+// Map a file written by graph_save/graph_csr_save. Returns NULL if the file
+// cannot be opened or mapped, fails validation, or on OOM.
+GraphCSR *graph_open_mmap(const char *path)
+{
+    // The offsets section is used in place as size_t[]
+    if (!path || sizeof(size_t) != sizeof(uint64_t)) return NULL;
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return NULL;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(GraphFileHeader)) {
+        close(fd);
+        return NULL;
+    }
+    size_t size = (size_t)st.st_size;
+    void *base = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);  // The mapping stays valid after the descriptor is closed
+    if (base == MAP_FAILED) return NULL;
+
+    const char *bytes = base;
+    const GraphFileHeader *h = base;
+    GraphCSR *csr = NULL;
+    const char **names = NULL;
+    if (!header_valid(h, size)) goto fail;
+
+    // --- Row offsets ---
+    const uint64_t *offsets = (const uint64_t *)(bytes + h->offsets_off);
+    if (offsets[0] != 0 || offsets[h->n] != h->m) goto fail;
+    for (uint64_t i = 0; i < h->n; ++i)
+        if (offsets[i] > offsets[i + 1]) goto fail;
+
+    // --- Neighbor indices and weights ---
+    if (!adj_valid(offsets, (const uint32_t *)(bytes + h->adj_off),
+                   (const int32_t *)(bytes + h->weights_off), h->n)) goto fail;
+
+    // --- Name table -> pointer table ---
+    names = malloc((h->n ? h->n : 1) * sizeof(const char *));
+    if (!names) goto fail;
+    const char *p = bytes + h->names_off, *end = p + h->names_len;
+    for (uint64_t i = 0; i < h->n; ++i) {
+        const char *nul = memchr(p, '\0', (size_t)(end - p));
+        if (!nul || nul == p) goto fail;
+        if (i > 0 && strcmp(names[i - 1], p) >= 0) goto fail;
+        names[i] = p;
+        p = nul + 1;
+    }
+    if (p != end) goto fail;
+
+    csr = calloc(1, sizeof(GraphCSR));
+    if (!csr) goto fail;
+    csr->n = (size_t)h->n;
+    csr->m = (size_t)h->m;
+    csr->offsets = (size_t *)(bytes + h->offsets_off);
+    csr->adj     = (uint32_t *)(bytes + h->adj_off);
+    csr->weights = (int *)(bytes + h->weights_off);
+    csr->names   = names;
+    csr->mapping = base;
+    csr->mapping_len = size;
+    return csr;
+
+fail:
+    free(names);
+    munmap(base, size);
+    return NULL;
+}
+
+// Release a snapshot returned by graph_open_mmap (called by graph_csr_destroy).
+void graph_csr_unmap(GraphCSR *csr)
+{
+    munmap(csr->mapping, csr->mapping_len);
+    free(csr->names);
+    free(csr);
+}
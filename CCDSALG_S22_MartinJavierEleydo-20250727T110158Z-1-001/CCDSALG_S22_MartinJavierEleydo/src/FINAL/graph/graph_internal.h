@@ -0,0 +1,47 @@
+/* ===========================================================================
+ *  FILE: graph_internal.h — Traversal view of the Graph for in-tree modules
+ *  ---------------------------------------------------------------------------
+ *  For the project's own traversal and path modules (dfs, path_check, ...)
+ *  that need the raw adjacency of a live Graph without copies. It exposes
+ *  vertex indices and read-only adjacency spans, never the struct layout, so
+ *  graph.c can change how it stores vertices and edges freely as long as
+ *  these functions keep their contract.
+ *
+ *    - Vertex index: the dense VertexId, 0 .. graph_index_bound() - 1.
+ *      graph_vertex_id() resolves a name to it; per-vertex scratch arrays
+ *      are sized with graph_index_bound() and indexed by it directly.
+ *    - Adjacency span: the vertex's (id, weight) entries, in lexicographic
+ *      order of the neighbor names, as a pointer and a length. Index it
+ *      forwards or backwards; a DFS can push in reverse without a buffer.
+ *
+ *  A span borrows the graph's storage: any edge change at that vertex (or
+ *  graph_destroy) invalidates it. Not for use outside src/FINAL.
+ * =========================================================================== */
+
+#ifndef GRAPH_INTERNAL_H
+#define GRAPH_INTERNAL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include "graph.h"
+
+typedef struct GraphAdjSpan {
+    const GraphNeighbor *adj;   // First entry (NULL when deg == 0)
+    uint32_t             deg;   // Number of entries
+} GraphAdjSpan;
+
+// One past the largest vertex index in use (0 for NULL). O(1).
+size_t graph_index_bound(const Graph *g);
+
+// Adjacency span of vertex 'id'; { NULL, 0 } for a missing vertex. O(1).
+GraphAdjSpan graph_adj_span(const Graph *g, VertexId id);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GRAPH_INTERNAL_H */
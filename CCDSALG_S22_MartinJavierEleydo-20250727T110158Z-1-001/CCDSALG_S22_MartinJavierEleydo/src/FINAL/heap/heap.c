@@ -220,3 +220,175 @@ bool heap_decrease_key(Heap *h, size_t idx, int new_key)
     sift_up(h, idx);
     return true;
 }
+
+/* ============================================================================
+ * IndexedHeap Structure
+ * ----------------------------------------------------------------------------
+ * Binary min-heap of item ids with a reverse position table:
+ *   - key/item: parallel arrays of heap slots (size entries in use)
+ *   - pos:      pos[id] = slot currently holding id, or SIZE_MAX if absent
+ *
+ * Every swap keeps pos[] in sync, so decrease-key can locate an item in O(1)
+ * no matter how many sifts happened since it was pushed.
+ * ============================================================================
+ */
+struct IndexedHeap {
+    size_t  size;   // Number of items currently in the heap
+    size_t  n;      // Id universe: valid ids are 0..n-1
+    int    *key;    // key[slot]  – priority of the item in that slot
+    size_t *item;   // item[slot] – id stored in that slot
+    size_t *pos;    // pos[id]    – slot of id, SIZE_MAX when not in the heap
+};
+
+static void iswap(IndexedHeap *h, size_t i, size_t j)
+{
+    int    k_tmp = h->key[i];
+    size_t i_tmp = h->item[i];
+    h->key[i]  = h->key[j];
+    h->item[i] = h->item[j];
+    h->key[j]  = k_tmp;
+    h->item[j] = i_tmp;
+    h->pos[h->item[i]] = i;
+    h->pos[h->item[j]] = j;
+}
+
+static void isift_up(IndexedHeap *h, size_t i)
+{
+    while (i && h->key[(i-1)/2] > h->key[i]) {
+        size_t p = (i-1)/2;
+        iswap(h, i, p);
+        i = p;
+    }
+}
+
+static void isift_down(IndexedHeap *h, size_t i)
+{
+    while (1) {
+        size_t l = 2*i + 1;
+        size_t r = l + 1;
+        size_t smallest = i;
+        if (l < h->size && h->key[l] < h->key[smallest]) smallest = l;
+        if (r < h->size && h->key[r] < h->key[smallest]) smallest = r;
+        if (smallest == i) break;
+        iswap(h, i, smallest);
+        i = smallest;
+    }
+}
+
+/* ============================================================================
+ * iheap_create / iheap_destroy
+ * ----------------------------------------------------------------------------
+ * All arrays are sized to the id universe up front, so pushes never resize.
+ * ============================================================================
+ */
+IndexedHeap *iheap_create(size_t n)
+{
+    IndexedHeap *h = malloc(sizeof(IndexedHeap));
+    if (!h) return NULL;
+    size_t cap = n ? n : 1;
+    h->size = 0;
+    h->n    = n;
+    h->key  = malloc(cap * sizeof(int));
+    h->item = malloc(cap * sizeof(size_t));
+    h->pos  = malloc(cap * sizeof(size_t));
+    if (!h->key || !h->item || !h->pos) { iheap_destroy(h); return NULL; }
+    for (size_t i = 0; i < n; ++i) h->pos[i] = SIZE_MAX;
+    return h;
+}
+
+void iheap_destroy(IndexedHeap *h)
+{
+    if (!h) return;
+    free(h->key);
+    free(h->item);
+    free(h->pos);
+    free(h);
+}
+
+/* ============================================================================
+ * iheap_push / iheap_contains / iheap_is_empty
+ * ============================================================================
+ */
+bool iheap_push(IndexedHeap *h, size_t id, int key)
+{
+    if (!h || id >= h->n || key < 0 || h->pos[id] != SIZE_MAX) return false;
+    size_t slot = h->size++;
+    h->key[slot]  = key;
+    h->item[slot] = id;
+    h->pos[id]    = slot;
+    isift_up(h, slot);
+    return true;
+}
+
+bool iheap_contains(const IndexedHeap *h, size_t id)
+{
+    return h && id < h->n && h->pos[id] != SIZE_MAX;
+}
+
+bool iheap_is_empty(const IndexedHeap *h) { return !h || h->size == 0; }
+
+/* ============================================================================
+ * iheap_clear
+ * ----------------------------------------------------------------------------
+ * Only the slots in use are reset in pos[].
+ * ============================================================================
+ */
+void iheap_clear(IndexedHeap *h)
+{
+    if (!h) return;
+    for (size_t i = 0; i < h->size; ++i) h->pos[h->item[i]] = SIZE_MAX;
+    h->size = 0;
+}
+
+/* ============================================================================
+ * iheap_extract_min
+ * ----------------------------------------------------------------------------
+ * Removes the root, moves the last slot to the root and sifts it down.
+ * O(log n)
+ * ============================================================================
+ */
+size_t iheap_extract_min(IndexedHeap *h, int *out_key)
+{
+    if (!h || h->size == 0) return SIZE_MAX;
+    size_t out = h->item[0];
+    if (out_key) *out_key = h->key[0];
+    h->pos[out] = SIZE_MAX;
+    h->size--;
+    if (h->size) {
+        h->key[0]  = h->key[h->size];
+        h->item[0] = h->item[h->size];
+        h->pos[h->item[0]] = 0;
+        isift_down(h, 0);
+    }
+    return out;
+}
+
+/* ============================================================================
+ * iheap_peek_min
+ * ----------------------------------------------------------------------------
+ * Reads the root slot. O(1)
+ * ============================================================================
+ */
+size_t iheap_peek_min(const IndexedHeap *h, int *out_key)
+{
+    if (!h || h->size == 0) return SIZE_MAX;
+    if (out_key) *out_key = h->key[0];
+    return h->item[0];
+}
+
+/* ============================================================================
+ * iheap_decrease_key
+ * ----------------------------------------------------------------------------
+ * Looks up the item's slot through pos[] and sifts it up after lowering.
+ * O(log n)
+ * ============================================================================
+ */
+bool iheap_decrease_key(IndexedHeap *h, size_t id, int new_key)
+{
+    if (!iheap_contains(h, id)) return false;
+    size_t slot = h->pos[id];
+    if (new_key >= h->key[slot]) return false;
+    h->key[slot] = new_key;
+    isift_up(h, slot);
+    return true;
+}
@@ -26,6 +26,16 @@
  *    bool    heap_is_empty(const Heap*);
  *    void   *heap_extract_min(Heap*, int *out_key); // Remove min, optionally get key
  *    bool    heap_decrease_key(Heap*, size_t idx, int new_key); // Lower priority
+ *
+ *  IndexedHeap (same file) is the companion for graph algorithms whose items are
+ *  dense vertex indices 0..n-1: it tracks every item's position internally, so
+ *  decrease-key is addressed by item id and stays valid across sift operations.
+ *    IndexedHeap *iheap_create(size_t n);     // Items are ids in [0, n)
+ *    bool    iheap_push(IndexedHeap*, size_t id, int key);
+ *    bool    iheap_decrease_key(IndexedHeap*, size_t id, int new_key);
+ *    size_t  iheap_extract_min(IndexedHeap*, int *out_key); // SIZE_MAX if empty
+ *    size_t  iheap_peek_min(const IndexedHeap*, int *out_key); // Same, no removal
+ *    void    iheap_clear(IndexedHeap*);       // Empty in O(size), for reuse
  * ============================================================================
  */
 
@@ -111,6 +121,80 @@ void   *heap_extract_min(Heap *h, int *out_key);
  */
 bool    heap_decrease_key(Heap *h, size_t idx, int new_key);
 
+/* ============================================================================
+ * OPAQUE INDEXED HEAP TYPE
+ * ----------------------------------------------------------------------------
+ *  Min-heap over integer item ids in [0, n). Each id is in the heap at most
+ *  once; a position table maps id -> slot, giving "real" decrease-key.
+ *  Keys follow the Heap rules (non-negative integers).
+ * ============================================================================
+ */
+typedef struct IndexedHeap IndexedHeap;
+
+/* ============================================================================
+ * iheap_create / iheap_destroy
+ * ----------------------------------------------------------------------------
+ *  Create an empty indexed heap able to hold ids 0..n-1 (O(n) setup).
+ *  Returns NULL on allocation failure. iheap_destroy is safe to call on NULL.
+ * ============================================================================
+ */
+IndexedHeap *iheap_create(size_t n);
+void         iheap_destroy(IndexedHeap *h);
+
+/* ============================================================================
+ * iheap_push
+ * ----------------------------------------------------------------------------
+ *  Inserts item @p id with priority @p key. Returns false if the id is out of
+ *  range, already in the heap, or the key is negative. O(log n).
+ * ============================================================================
+ */
+bool    iheap_push(IndexedHeap *h, size_t id, int key);
+
+/* ============================================================================
+ * iheap_contains / iheap_is_empty
+ * ----------------------------------------------------------------------------
+ *  Membership test for @p id, and emptiness test (true for NULL). O(1).
+ * ============================================================================
+ */
+bool    iheap_contains(const IndexedHeap *h, size_t id);
+bool    iheap_is_empty(const IndexedHeap *h);
+
+/* ============================================================================
+ * iheap_clear
+ * ----------------------------------------------------------------------------
+ *  Removes every item. Costs O(items in the heap), not O(n), so one heap can
+ *  serve many small searches over a large id universe.
+ * ============================================================================
+ */
+void    iheap_clear(IndexedHeap *h);
+
+/* ============================================================================
+ * iheap_extract_min
+ * ----------------------------------------------------------------------------
+ *  Removes and returns the id with the smallest key (key stored in @p out_key
+ *  when not NULL). Returns SIZE_MAX if the heap is empty or NULL. O(log n).
+ * ============================================================================
+ */
+size_t  iheap_extract_min(IndexedHeap *h, int *out_key);
+
+/* ============================================================================
+ * iheap_peek_min
+ * ----------------------------------------------------------------------------
+ *  Like iheap_extract_min but leaves the item in the heap. O(1).
+ * ============================================================================
+ */
+size_t  iheap_peek_min(const IndexedHeap *h, int *out_key);
+
+/* ============================================================================
+ * iheap_decrease_key
+ * ----------------------------------------------------------------------------
+ *  Lowers the key of item @p id (which must currently be in the heap) to
+ *  @p new_key. Returns false if @p id is absent or @p new_key is not strictly
+ *  smaller than its current key. O(log n).
+ * ============================================================================
+ */
+bool    iheap_decrease_key(IndexedHeap *h, size_t id, int new_key);
+
 #ifdef __cplusplus
 }
 #endif
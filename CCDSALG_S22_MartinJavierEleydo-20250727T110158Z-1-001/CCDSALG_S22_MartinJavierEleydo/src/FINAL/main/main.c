@@ -9,16 +9,20 @@
  *    2  <u> <v> <weight> - Add edge (undirected, weighted)
  *    3  <name>           - Get vertex degree
  *    4  <u> <v>          - Check if edge exists
- *    5  <start>          - BFS traversal
+ *    5  <start> [parallel] - BFS traversal
  *    6  <start>          - DFS traversal  
  *    7  <src> <dst>      - Check path connectivity
- *    8                   - Find MST (Prim’s)
- *    9  <src> <dst>      - Find shortest path (Dijkstra’s)
+ *    8  [prim|kruskal|boruvka] - Find MST (Prim’s by default)
+ *    9  <src> <dst> [bidir|dial|heap|alt|delta|ch] - Find shortest path (Dijkstra’s)
  *    10                  - Print graph (vertices/edges)
  *    11                  - Exit
+ *    12 <src> <dst> [<dst> ...] - Shortest paths from one source (one line each)
  *
  *  Design Notes:
  *    - Input is line-based; commands must be precisely formatted.
+ *    - Read-only traversals (5, 6, 8, 9, 12) run on a CSR snapshot of the graph
+ *      that is rebuilt lazily after commands 1 and 2 modify it; command 7
+ *      uses the graph's connectivity index.
  *    - Unknown or malformed commands are ignored or output minimal default.
  *    - Each command is dispatched to a handler for modularity and clarity.
  * ============================================================================
@@ -41,8 +45,9 @@
 #include "path_check.h"
 #include "mst.h"
 #include "shortest_Path.h"
+#include "contraction.h"
 
-#define MAX_LINE_LEN 1024
+#define MAX_LINE_LEN 65536   // Command 12 may list hundreds of targets
 #define MAX_TOKEN_LEN 257
 
 /* ============================================================================
@@ -92,6 +97,65 @@ static int parse_tokens(char *line, char tokens[][MAX_TOKEN_LEN], int max_tokens
     return count;
 }
 
+/* ============================================================================
+ *  READ SNAPSHOT
+ *  ---------------------------------------------------------------------------
+ *  Commands 5, 6, 8 and 9 only read the graph, so they run on a GraphCSR
+ *  snapshot (contiguous arrays) instead of the linked lists. The snapshot is
+ *  frozen on first use and discarded whenever command 1 or 2 changes the
+ *  graph. If it cannot be built (out of memory), handlers fall back to the
+ *  Graph versions. Command 7 uses the graph's connectivity index directly.
+ *  The ALT landmark table ("9 <src> <dst> alt") and the contraction-hierarchy
+ *  index ("9 <src> <dst> ch") are built from the snapshot on first use and
+ *  dropped with it, so a weight change forces a rebuild. The same holds for
+ *  the LRU of recent single-source trees behind command 12.
+ * ============================================================================
+ */
+static GraphCSR *read_snapshot = NULL;
+static SPLandmarks *read_landmarks = NULL;
+static CHIndex *read_ch = NULL;
+static SPTreeCache *read_trees = NULL;
+
+static const GraphCSR *read_view(Graph *g)
+{
+    if (!read_snapshot) read_snapshot = graph_freeze(g);
+    return read_snapshot;
+}
+
+static SPLandmarks *read_landmarks_view(Graph *g)
+{
+    const GraphCSR *csr = read_view(g);
+    if (csr && !read_landmarks)
+        read_landmarks = sp_landmarks_build(csr, SP_ALT_DEFAULT_LANDMARKS);
+    return read_landmarks;
+}
+
+static CHIndex *read_ch_view(Graph *g)
+{
+    const GraphCSR *csr = read_view(g);
+    if (csr && !read_ch) read_ch = ch_build(csr);
+    return read_ch;
+}
+
+static SPTreeCache *read_trees_view(Graph *g)
+{
+    const GraphCSR *csr = read_view(g);
+    if (csr && !read_trees) read_trees = sp_tree_cache_create(csr, SP_TREE_CACHE_DEFAULT);
+    return read_trees;
+}
+
+static void invalidate_read_view(void)
+{
+    sp_tree_cache_destroy(read_trees);
+    read_trees = NULL;
+    ch_destroy(read_ch);
+    read_ch = NULL;
+    sp_landmarks_destroy(read_landmarks);
+    read_landmarks = NULL;
+    graph_csr_destroy(read_snapshot);
+    read_snapshot = NULL;
+}
+
 /* ============================================================================
  *  COMMAND HANDLERS
  *  ---------------------------------------------------------------------------
@@ -107,23 +171,24 @@ static void handle_add_vertex(Graph *g, char tokens[][MAX_TOKEN_LEN], int token_
 {
     if (token_count != 2) return; // Spec: ignore bad format
     const char *name = tokens[1];
-    graph_add_vertex(g, name);
+    if (graph_add_vertex(g, name)) invalidate_read_view();
 }
 
 static void handle_add_edge(Graph *g, char tokens[][MAX_TOKEN_LEN], int token_count)
 {
     if (token_count != 4) return;
-    const char *u = tokens[1];
-    const char *v = tokens[2];
+    // Names are resolved to ids here, at the CLI boundary
+    VertexId u = graph_vertex_id(g, tokens[1]);
+    VertexId v = graph_vertex_id(g, tokens[2]);
     int weight = atoi(tokens[3]);
-    graph_add_edge(g, u, v, weight);
+    if (graph_add_edge_id(g, u, v, weight)) invalidate_read_view();
 }
 
 static void handle_get_degree(Graph *g, char tokens[][MAX_TOKEN_LEN], int token_count)
 {
     if (token_count != 2) return;
-    const char *name = tokens[1];
-    int degree = graph_get_degree(g, name);
+    VertexId id = graph_vertex_id(g, tokens[1]);
+    int degree = graph_get_degree_id(g, id);
     if (degree >= 0) {
         printf("%d\n", degree);
     }
@@ -132,20 +197,25 @@ static void handle_get_degree(Graph *g, char tokens[][MAX_TOKEN_LEN], int token_
 static void handle_edge_exists(Graph *g, char tokens[][MAX_TOKEN_LEN], int token_count)
 {
     if (token_count != 3) return;
-    const char *u = tokens[1];
-    const char *v = tokens[2];
-    bool exists = graph_edge_exists(g, u, v);
+    VertexId u = graph_vertex_id(g, tokens[1]);
+    VertexId v = graph_vertex_id(g, tokens[2]);
+    bool exists = graph_edge_exists_id(g, u, v);
     printf("%d\n", exists ? 1 : 0);
 }
 
 static void handle_bfs(Graph *g, Queue *scratch_queue, char tokens[][MAX_TOKEN_LEN], int token_count)
 {
-    if (token_count != 2) {
+    // Optional "parallel" selects the multithreaded engine (same output)
+    bool parallel = token_count == 3 && strcmp(tokens[2], "parallel") == 0;
+    if (token_count != 2 && !parallel) {
         putchar('\n'); // Per spec: print empty line for bad input
         return;
     }
     const char *start = tokens[1];
-    bfs(g, start);
+    const GraphCSR *csr = read_view(g);
+    if (csr && parallel) bfs_parallel_print_csr(csr, start, 0);
+    else if (csr)        bfs_diropt_csr(csr, start);
+    else                 bfs(g, start);
 }
 
 static void handle_dfs(Graph *g, Stack *scratch_stack, char tokens[][MAX_TOKEN_LEN], int token_count)
@@ -155,7 +225,9 @@ static void handle_dfs(Graph *g, Stack *scratch_stack, char tokens[][MAX_TOKEN_L
         return;
     }
     const char *start = tokens[1];
-    cmd_dfs(g, start, scratch_stack);
+    const GraphCSR *csr = read_view(g);
+    if (csr) cmd_dfs_csr(csr, start, scratch_stack);
+    else     cmd_dfs(g, start, scratch_stack);
 }
 
 static void handle_path_check(Graph *g, Stack *scratch_stack, char tokens[][MAX_TOKEN_LEN], int token_count)
@@ -164,26 +236,74 @@ static void handle_path_check(Graph *g, Stack *scratch_stack, char tokens[][MAX_
         printf("0\n"); // Per spec: print 0 if format invalid (no path)
         return;
     }
-    const char *src = tokens[1];
-    const char *dst = tokens[2];
-    cmd_path(g, src, dst, scratch_stack);
+    // Answered by the graph's connectivity index; no snapshot needed
+    cmd_path(g, tokens[1], tokens[2], scratch_stack);
 }
 
 static void handle_mst(Graph *g, char tokens[][MAX_TOKEN_LEN], int token_count)
 {
-    (void)tokens; (void)token_count; // Unused: only '8' triggers this
-    primMST(g);
+    // Optional engine name ("8 kruskal"); anything else keeps Prim's output
+    MSTAlgorithm algo = MST_PRIM;
+    if (token_count == 2) mst_algorithm_from_name(tokens[1], &algo);
+    const GraphCSR *csr = read_view(g);
+    if (csr) mst_print_csr(csr, algo);
+    else     primMST(g);
 }
 
 static void handle_shortest_path(Graph *g, char tokens[][MAX_TOKEN_LEN], int token_count)
 {
-    if (token_count != 3) {
+    if (token_count != 3 && token_count != 4) {
         printf("0\n"); // Per spec: print 0 if bad input
         return;
     }
     const char *src = tokens[1];
     const char *dst = tokens[2];
-    shortestPath(g, src, dst);
+    // Optional engine name ("9 A B heap"); the path printed is the same
+    SPEngine engine = SP_ENGINE_BIDIR;
+    if (token_count == 4) sp_engine_from_name(tokens[3], &engine);
+    CHIndex *ch = (engine == SP_ENGINE_CH) ? read_ch_view(g) : NULL;
+    if (ch) {
+        ch_print(ch, src, dst);
+        return;
+    }
+    SPLandmarks *lm = (engine == SP_ENGINE_ALT) ? read_landmarks_view(g) : NULL;
+    if (lm) {
+        sp_alt_print(lm, src, dst);
+        return;
+    }
+    if (engine == SP_ENGINE_ALT) engine = SP_ENGINE_BIDIR;
+    const GraphCSR *csr = read_view(g);
+    if (csr) sp_print_csr(csr, src, dst, engine);
+    else     shortestPath(g, src, dst);
+}
+
+/**
+ * Command 12: "12 <src> <dst> [<dst> ...]". Targets are read from the raw
+ * line, so the list is not bound by the 10-token limit of other commands.
+ * One single-source tree (cached per snapshot) answers every target.
+ */
+static void handle_batch_shortest_path(Graph *g, char *raw_line)
+{
+    size_t cap = strlen(raw_line) / 2 + 1;   // Upper bound on token count
+    const char **tokens = malloc(cap * sizeof(const char *));
+    if (!tokens) {
+        printf("0\n");
+        return;
+    }
+    size_t count = 0;
+    for (char *tok = strtok(raw_line, " \t\n\r"); tok && count < cap; tok = strtok(NULL, " \t\n\r"))
+        tokens[count++] = tok;
+    if (count < 3) {
+        printf("0\n"); // Per spec: print 0 if bad input
+        free(tokens);
+        return;
+    }
+    const char *src = tokens[1];
+    const char *const *targets = tokens + 2;
+    SPTreeCache *cache = read_trees_view(g);
+    if (cache) sp_batch_print(cache, src, targets, count - 2);
+    else       shortestPathBatch(g, src, targets, count - 2);
+    free(tokens);
 }
 
 static void handle_print_graph(Graph *g, char tokens[][MAX_TOKEN_LEN], int token_count)
@@ -222,7 +342,8 @@ int main(void)
     }
 
     // --- Command processing loop (reads stdin line-by-line) ---
-    char line[MAX_LINE_LEN];
+    static char line[MAX_LINE_LEN];
+    static char raw_line[MAX_LINE_LEN];   // Untokenized copy for command 12
     char tokens[10][MAX_TOKEN_LEN]; // Up to 10 tokens per command
     while (fgets(line, sizeof(line), stdin)) {
         trim_whitespace(line);
@@ -230,10 +351,11 @@ int main(void)
         if (strlen(line) == 0) continue;
 
         // Tokenize command input
+        memcpy(raw_line, line, strlen(line) + 1);
         int token_count = parse_tokens(line, tokens, 10);
         if (token_count == 0) continue;
 
-        // Parse command code (must be integer 1–11)
+        // Parse command code (must be integer 1–12)
         int cmd = atoi(tokens[0]);
         switch (cmd) {
             case 11:
@@ -259,6 +381,8 @@ int main(void)
                 handle_shortest_path(graph, tokens, token_count);     break;
             case 10:
                 handle_print_graph(graph, tokens, token_count);       break;
+            case 12:
+                handle_batch_shortest_path(graph, raw_line);          break;
             default:
                 // Unrecognized command: ignore (per spec)
                 break;
@@ -267,6 +391,7 @@ int main(void)
 
 cleanup:
     // --- Clean up all data structures before exit ---
+    invalidate_read_view();
     graph_destroy(graph);
     stack_destroy(scratch_stack);
     queue_destroy(scratch_queue);
@@ -20,156 +20,367 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
 #include "graph.h"
 #include "heap.h"
+#include "mst.h"
 
-#define MAX_V 100
 #define INF 999999
-#define MAX_NAME_LEN 256
 
-// Struct to hold edge information for printing
-typedef struct {
-    char u[MAX_NAME_LEN], v[MAX_NAME_LEN];
-    int weight;
-} Edge;
+#define MST_MAX_WEIGHT 100  // Graph edge weights are 1..100 (Kruskal bucket count)
+
+// Print the MST in the required format (edges must already be sorted)
+void mst_print(const MSTResult *r) {
+    printf("%s = (V,E)\n", "MST");
+
+    // Print vertices set
+    printf("V = {");
+    for (size_t i = 0; i < r->n; i++) {
+        printf("%s", r->names[i]);
+        if (i != r->n - 1) printf(", ");
+    }
+    printf("}\n");
+
+    // Print edges set
+    printf("E = {\n");
+    for (size_t i = 0; i < r->edge_count; i++) {
+        const MSTEdge *e = &r->edges[i];
+        printf("  (%s, %s, %d)", r->names[e->u], r->names[e->v], e->weight);
+        if (i != r->edge_count - 1) printf(",\n");
+    }
+    printf("\n}\n");
+
+    // Print total weight of the MST
+    printf("Total Edge Weight: %ld\n", r->total_weight);
+}
+
+// Release the arrays owned by a result. Safe on NULL.
+void mst_result_free(MSTResult *r) {
+    if (!r) return;
+    free(r->names);
+    free(r->edges);
+    r->names = NULL;
+    r->edges = NULL;
+    r->n = r->edge_count = 0;
+}
+
+// qsort comparator: by (u, v) index, i.e. lexicographic order
+static int cmp_mst_edge(const void *pa, const void *pb) {
+    const MSTEdge *a = pa, *b = pb;
+    if (a->u != b->u) return (a->u < b->u) ? -1 : 1;
+    if (a->v != b->v) return (a->v < b->v) ? -1 : 1;
+    return 0;
+}
 
 void primMST(Graph *g) {
     // --------------------------------------------------------------------------
-    // STEP 1: Get all vertices and sort them lexicographically
+    // STEP 1: Number the vertices by lexicographic rank
     // --------------------------------------------------------------------------
-    char names[MAX_V][MAX_NAME_LEN];
-    int n = graph_get_all_vertices(g, names);
-    char label[MAX_NAME_LEN];
-
-    // Sorting vertices: ensures that both the MST and output are deterministic
-    for (int i = 0; i < n - 1; i++) {
-        for (int j = i + 1; j < n; j++) {
-            if (strcmp(names[i], names[j]) > 0) {
-                char tmp[MAX_NAME_LEN];
-                strcpy(tmp, names[i]);
-                strcpy(names[i], names[j]);
-                strcpy(names[j], tmp);
-            }
-        }
+    // All per-vertex scratch is heap-allocated and sized by the vertex count,
+    // so there is no fixed limit on graph size. The graph hands out ids in
+    // name order, so rank[id] replaces the old name sort and name scans.
+    int n = (int)graph_vertex_count(g);
+    size_t cap = n ? (size_t)n : 1;
+    const char **byId = malloc(cap * sizeof(const char *));
+    const char **names = malloc(cap * sizeof(const char *)); // names[i]: i-th name in lex order
+    VertexId *ids = malloc(cap * sizeof(VertexId));          // ids[i]: id of names[i]
+    int *rank = malloc(cap * sizeof(int));                   // rank[id]: lex position of id
+    int *key = malloc(cap * sizeof(int));      // key[v]: minimum weight to connect vertex v to MST
+    int *inMST = calloc(cap, sizeof(int));     // inMST[v]: whether vertex v is included in MST
+    int *parent = malloc(cap * sizeof(int));   // parent[v]: parent of v in MST
+    MSTEdge *found = malloc(cap * sizeof(MSTEdge)); // MST edges by rank
+    Heap *minHeap = heap_create(n);            // Min-heap for vertex selection by key
+    if (!byId || !names || !ids || !rank || !key || !inMST ||
+        !parent || !found || !minHeap) {
+        free(byId); free(names); free(ids); free(rank);
+        free(key); free(inMST); free(parent); free(found);
+        heap_destroy(minHeap);
+        return;
+    }
+    graph_get_names_by_id(g, byId);
+    graph_get_vertex_ids(g, ids);
+    for (int i = 0; i < n; i++) {
+        names[i] = byId[ids[i]];
+        rank[ids[i]] = i;
     }
 
     // --------------------------------------------------------------------------
     // STEP 2: Initialize Prim’s Algorithm Structures
     // --------------------------------------------------------------------------
-    int key[MAX_V];        // key[v]: minimum weight to connect vertex v to MST
-    int inMST[MAX_V] = {0}; // inMST[v]: whether vertex v is included in MST
-    int parent[MAX_V];     // parent[v]: parent of v in MST
-    char *heapNames[MAX_V];// heapNames[i]: dynamic names for min-heap
-    Edge edges[MAX_V];     // To record MST edges for printing
-    int edgeCount = 0, totalWeight = 0;
-
-    // Create a min-heap for vertex selection by key
-    Heap *minHeap = heap_create(n);
+    int edgeCount = 0;
+    long totalWeight = 0;
+
+    // Heap payloads point into names[]; the rank is the pointer offset
     for (int i = 0; i < n; i++) {
         key[i] = (i == 0) ? 0 : INF; // Start from the first vertex (arbitrary)
         parent[i] = -1;
-        heapNames[i] = malloc(strlen(names[i]) + 1);
-        strcpy(heapNames[i], names[i]);
-        heap_push(minHeap, heapNames[i], key[i]);
+        heap_push(minHeap, (void *)&names[i], key[i]);
     }
 
     // --------------------------------------------------------------------------
     // STEP 3: Prim’s Algorithm Main Loop
     // --------------------------------------------------------------------------
     while (!heap_is_empty(minHeap)) {
-        int u_key;
-        char *u_name = heap_extract_min(minHeap, &u_key);
-
-        // Find the index of u_name in names[] (for O(1) access to key/parent)
-        int u = -1;
-        for (int i = 0; i < n; i++) {
-            if (strcmp(names[i], u_name) == 0) {
-                u = i;
-                break;
-            }
-        }
+        const char **entry = heap_extract_min(minHeap, NULL);
+        int u = (int)(entry - names);
 
-        // If vertex already included, or error, skip
-        if (u == -1 || inMST[u]) continue;
+        // If vertex already included, skip (outdated heap entry)
+        if (inMST[u]) continue;
         inMST[u] = 1;
 
-        // If this is not the root, record MST edge (parent[u] - u)
+        // If this is not the root, record MST edge (parent[u] - u) in rank order
         if (parent[u] != -1) {
-            const char *a = names[parent[u]];
-            const char *b = names[u];
-            // Always record edge in lex order (for deterministic print)
-            if (strcmp(a, b) < 0) {
-                strcpy(edges[edgeCount].u, a);
-                strcpy(edges[edgeCount].v, b);
-            } else {
-                strcpy(edges[edgeCount].u, b);
-                strcpy(edges[edgeCount].v, a);
-            }
-            edges[edgeCount].weight = key[u];
+            uint32_t a = (uint32_t)parent[u], b = (uint32_t)u;
+            found[edgeCount].u = a < b ? a : b;
+            found[edgeCount].v = a < b ? b : a;
+            found[edgeCount].weight = key[u];
             totalWeight += key[u];
             edgeCount++;
         }
 
-        // Update neighbors: for every vertex v, if edge u-v exists, and v not in MST,
-        // and weight is lower than current key[v], update key and parent.
-        for (int v = 0; v < n; v++) {
-            int weight = graph_get_edge_weight(g, names[u], names[v]);
+        // Update neighbors: for every neighbor v not in MST whose edge weight
+        // is lower than key[v], update key and parent. Neighbors are walked in
+        // place in name order, so heap pushes (and tie decisions) follow rank order.
+        GraphNeighborIter it;
+        graph_neighbors_begin(g, ids[u], &it);
+        for (const GraphNeighbor *nb; (nb = graph_neighbors_next(&it)); ) {
+            int v = rank[nb->id];
+            int weight = nb->weight;
             if (!inMST[v] && weight > 0 && weight < key[v]) {
                 key[v] = weight;
                 parent[v] = u;
 
-                // Instead of decrease-key (no heap handles), push new (name, weight)
+                // Instead of decrease-key (no heap handles), push new (entry, weight)
                 // This may leave outdated heap entries, but correctness is preserved
-                char *nameCopy = malloc(strlen(names[v]) + 1);
-                strcpy(nameCopy, names[v]);
-                heap_push(minHeap, nameCopy, weight);
+                heap_push(minHeap, (void *)&names[v], weight);
             }
         }
     }
 
     // --------------------------------------------------------------------------
-    // STEP 4: Cleanup Dynamic Names and Heap Memory
+    // STEP 4: Cleanup Heap Memory
     // --------------------------------------------------------------------------
-    for (int i = 0; i < n; i++) {
-        free(heapNames[i]);
-    }
     heap_destroy(minHeap);
 
     // --------------------------------------------------------------------------
     // STEP 5: Sort and Print MST Output
     // --------------------------------------------------------------------------
-    // Sort edges in lexicographic order for deterministic output
-    for (int i = 0; i < edgeCount - 1; i++) {
-        for (int j = i + 1; j < edgeCount; j++) {
-            if (strcmp(edges[i].u, edges[j].u) > 0 ||
-                (strcmp(edges[i].u, edges[j].u) == 0 && strcmp(edges[i].v, edges[j].v) > 0)) {
-                Edge temp = edges[i];
-                edges[i] = edges[j];
-                edges[j] = temp;
+    // Rank order is lexicographic order, so sorting ranks sorts the output
+    qsort(found, (size_t)edgeCount, sizeof(MSTEdge), cmp_mst_edge);
+    MSTResult result = { (size_t)n, names, found, (size_t)edgeCount, totalWeight };
+    mst_print(&result);
+
+    free(byId); free(names); free(ids); free(rank);
+    free(key); free(inMST); free(parent); free(found);
+}
+
+/*
+ * FUNCTION: mst_prim_csr
+ * ----------------------
+ * Prim's algorithm on a CSR snapshot, producing exactly the forest primMST
+ * prints.
+ *
+ * Vertices are already numbered in lexicographic order, so no sorting or name
+ * lookups are needed, and each extracted vertex scans only its own neighbor
+ * row. Neighbors are visited in ascending index order, so the sequence of
+ * heap pushes (and therefore every tie decision) matches primMST.
+ *
+ * Parameters:
+ *   - csr: snapshot produced by graph_freeze() or graph_open_mmap()
+ *   - out: filled on success; release with mst_result_free()
+ */
+bool mst_prim_csr(const GraphCSR *csr, MSTResult *out) {
+    memset(out, 0, sizeof *out);
+    int n = (int)csr->n;
+    int *key = malloc((n ? n : 1) * sizeof(int));
+    int *inMST = calloc(n ? n : 1, sizeof(int));
+    int *parent = malloc((n ? n : 1) * sizeof(int));
+    MSTEdge *found = malloc((n ? n : 1) * sizeof(MSTEdge));
+    const char **names = malloc((n ? n : 1) * sizeof(const char *));
+    Heap *minHeap = heap_create(n);
+    if (!key || !inMST || !parent || !found || !names || !minHeap) {
+        free(key); free(inMST); free(parent); free(found); free(names);
+        heap_destroy(minHeap);
+        return false;
+    }
+    memcpy(names, csr->names, (size_t)n * sizeof(const char *));
+
+    // Heap payloads point into csr->names; the index is the pointer offset
+    size_t edgeCount = 0;
+    long totalWeight = 0;
+    for (int i = 0; i < n; i++) {
+        key[i] = (i == 0) ? 0 : INF;
+        parent[i] = -1;
+        heap_push(minHeap, (void *)&csr->names[i], key[i]);
+    }
+
+    while (!heap_is_empty(minHeap)) {
+        const char **entry = heap_extract_min(minHeap, NULL);
+        int u = (int)(entry - csr->names);
+        if (inMST[u]) continue;
+        inMST[u] = 1;
+
+        if (parent[u] != -1) {
+            uint32_t a = (uint32_t)parent[u], b = (uint32_t)u;
+            found[edgeCount].u = a < b ? a : b;
+            found[edgeCount].v = a < b ? b : a;
+            found[edgeCount].weight = key[u];
+            totalWeight += key[u];
+            edgeCount++;
+        }
+
+        for (size_t k = csr->offsets[u]; k < csr->offsets[u + 1]; k++) {
+            int v = (int)csr->adj[k];
+            int weight = csr->weights[k];
+            if (!inMST[v] && weight < key[v]) {
+                key[v] = weight;
+                parent[v] = u;
+                heap_push(minHeap, (void *)&csr->names[v], weight);
             }
         }
     }
+    heap_destroy(minHeap);
+    free(key); free(inMST); free(parent);
 
-    // Print the MST in the required format
-    strcpy(label, "MST");
-    printf("%s = (V,E)\n", label);
+    // Index order is lexicographic order, so sorting indices sorts the output
+    qsort(found, edgeCount, sizeof(MSTEdge), cmp_mst_edge);
+    out->n = (size_t)n;
+    out->names = names;
+    out->edges = found;
+    out->edge_count = edgeCount;
+    out->total_weight = totalWeight;
+    return true;
+}
 
-    // Print vertices set
-    printf("V = {");
-    for (int i = 0; i < n; i++) {
-        printf("%s", names[i]);
-        if (i != n - 1) printf(", ");
+// Union-find over snapshot indices (union by rank, path halving)
+static uint32_t uf_find(uint32_t *parent, uint32_t x) {
+    while (parent[x] != x) {
+        parent[x] = parent[parent[x]];
+        x = parent[x];
     }
-    printf("}\n");
+    return x;
+}
 
-    // Print edges set
-    printf("E = {\n");
-    for (int i = 0; i < edgeCount; i++) {
-        printf("  (%s, %s, %d)", edges[i].u, edges[i].v, edges[i].weight);
-        if (i != edgeCount - 1) printf(",\n");
+static bool uf_union(uint32_t *parent, uint8_t *rank, uint32_t a, uint32_t b) {
+    a = uf_find(parent, a);
+    b = uf_find(parent, b);
+    if (a == b) return false;
+    if (rank[a] < rank[b]) { uint32_t t = a; a = b; b = t; }
+    parent[b] = a;
+    if (rank[a] == rank[b]) rank[a]++;
+    return true;
+}
+
+/*
+ * FUNCTION: mst_kruskal_csr
+ * -------------------------
+ * Kruskal's algorithm on a CSR snapshot, in O(E + V log V).
+ *
+ * Weights are bounded to 1..MST_MAX_WEIGHT, so edges are ordered with a
+ * counting sort (one bucket per weight) instead of a comparison sort; within
+ * a bucket, edges keep their (u, v) index order. Each edge is then accepted
+ * if union-find says it joins two different components. Only the accepted
+ * edges (at most V - 1) are sorted for output.
+ *
+ * Total weight always equals Prim's; when several edges tie on weight, the
+ * chosen edge set may differ from primMST's (both are minimum).
+ *
+ * Returns false on OOM or if a weight is outside 1..MST_MAX_WEIGHT.
+ */
+bool mst_kruskal_csr(const GraphCSR *csr, MSTResult *out) {
+    memset(out, 0, sizeof *out);
+    size_t n = csr->n;
+
+    // --- Counting sort of the edges by weight (each edge once, u < v) ---
+    size_t start[MST_MAX_WEIGHT + 2] = { 0 };
+    for (size_t u = 0; u < n; u++)
+        for (size_t k = csr->offsets[u]; k < csr->offsets[u + 1]; k++) {
+            int w = csr->weights[k];
+            if (w < 1 || w > MST_MAX_WEIGHT) return false;
+            if (u < csr->adj[k]) start[w + 1]++;
+        }
+    for (int w = 1; w <= MST_MAX_WEIGHT; w++) start[w + 1] += start[w];
+
+    // Sized from the count, not csr->m / 2: the two agree only when every
+    // row is mirrored, which a mapped file need not guarantee.
+    size_t m = start[MST_MAX_WEIGHT + 1];
+    MSTEdge *sorted = malloc((m ? m : 1) * sizeof(MSTEdge));
+    MSTEdge *found = malloc((n ? n : 1) * sizeof(MSTEdge));
+    const char **names = malloc((n ? n : 1) * sizeof(const char *));
+    uint32_t *parent = malloc((n ? n : 1) * sizeof(uint32_t));
+    uint8_t *rank = calloc(n ? n : 1, sizeof(uint8_t));
+    if (!sorted || !found || !names || !parent || !rank) {
+        free(sorted); free(found); free(names); free(parent); free(rank);
+        return false;
+    }
+    memcpy(names, csr->names, n * sizeof(const char *));
+    for (size_t u = 0; u < n; u++) {
+        parent[u] = (uint32_t)u;
+        for (size_t k = csr->offsets[u]; k < csr->offsets[u + 1]; k++) {
+            uint32_t v = csr->adj[k];
+            if (u < v) {
+                int w = csr->weights[k];
+                sorted[start[w]++] = (MSTEdge){ (uint32_t)u, v, w };
+            }
+        }
     }
-    printf("\n}\n");
 
-    // Print total weight of the MST
-    printf("Total Edge Weight: %d\n", totalWeight);
+    // --- Accept edges in weight order while they join two components ---
+    size_t edgeCount = 0;
+    long totalWeight = 0;
+    for (size_t i = 0; i < m && edgeCount + 1 < n; i++) {
+        if (uf_union(parent, rank, sorted[i].u, sorted[i].v)) {
+            found[edgeCount++] = sorted[i];
+            totalWeight += sorted[i].weight;
+        }
+    }
+    free(sorted); free(parent); free(rank);
+
+    qsort(found, edgeCount, sizeof(MSTEdge), cmp_mst_edge);
+    out->n = n;
+    out->names = names;
+    out->edges = found;
+    out->edge_count = edgeCount;
+    out->total_weight = totalWeight;
+    return true;
+}
+
+// Run the selected engine on a snapshot.
+bool mst_compute(const GraphCSR *csr, MSTAlgorithm algo, MSTResult *out) {
+    if (!csr || !out) return false;
+    switch (algo) {
+        case MST_PRIM:    return mst_prim_csr(csr, out);
+        case MST_KRUSKAL: return mst_kruskal_csr(csr, out);
+        case MST_BORUVKA: return mst_boruvka_csr(csr, 0, out);
+    }
+    return false;
+}
+
+// Parse an engine name ("prim", "kruskal" or "boruvka").
+bool mst_algorithm_from_name(const char *name, MSTAlgorithm *out) {
+    if (!name) return false;
+    if (strcmp(name, "prim") == 0)    { *out = MST_PRIM;    return true; }
+    if (strcmp(name, "kruskal") == 0) { *out = MST_KRUSKAL; return true; }
+    if (strcmp(name, "boruvka") == 0) { *out = MST_BORUVKA; return true; }
+    return false;
+}
+
+/*
+ * FUNCTION: primMST_csr
+ * ---------------------
+ * Prim's algorithm on a CSR snapshot, printing exactly what primMST prints.
+ *
+ * Parameters:
+ *   - csr: snapshot produced by graph_freeze()
+ */
+void primMST_csr(const GraphCSR *csr) {
+    mst_print_csr(csr, MST_PRIM);
+}
+
+// Compute with the selected engine and print in the primMST format.
+void mst_print_csr(const GraphCSR *csr, MSTAlgorithm algo) {
+    MSTResult r;
+    if (!mst_compute(csr, algo, &r)) return;
+    mst_print(&r);
+    mst_result_free(&r);
 }
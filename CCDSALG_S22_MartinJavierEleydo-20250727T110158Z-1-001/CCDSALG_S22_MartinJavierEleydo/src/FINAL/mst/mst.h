@@ -9,14 +9,53 @@
  *    - primMST(Graph *g): Computes and prints the MST of the provided graph
  *      using Prim’s algorithm (min-heap optimized). Output is lexicographically
  *      sorted for both vertices and edges, and total MST weight is printed.
+ *    - primMST_csr(const GraphCSR *csr): same output, computed on a CSR
+ *      snapshot (see graph_freeze()).
+ *    - mst_compute(): runs a runtime-selected engine (Prim or Kruskal) on a
+ *      snapshot and returns the forest as an MSTResult instead of printing it;
+ *      mst_print() prints a result in the primMST format.
+ *    - mst_boruvka_csr(): multi-threaded Borůvka engine (mst_boruvka.c).
  * ============================================================================
  */
 
 #ifndef MST_H
 #define MST_H
 
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 #include "graph.h"
 
+/*
+ * MSTEdge / MSTResult
+ * -------------------
+ * A minimum spanning forest over a snapshot's vertices (indices 0..n-1 in
+ * lexicographic order, as in GraphCSR). Disconnected graphs get one tree per
+ * component.
+ *   - names[i]   : name of vertex i (array owned, strings borrowed)
+ *   - edges[k]   : forest edges with u < v, sorted by (u, v)
+ *   - total_weight: sum of all edge weights
+ */
+typedef struct MSTEdge {
+    uint32_t u, v;
+    int      weight;
+} MSTEdge;
+
+typedef struct MSTResult {
+    size_t       n;
+    const char **names;
+    MSTEdge     *edges;
+    size_t       edge_count;
+    long         total_weight;
+} MSTResult;
+
+// MST engines selectable at runtime (see mst_algorithm_from_name).
+typedef enum MSTAlgorithm {
+    MST_PRIM,      // Binary heap; the edge set primMST prints
+    MST_KRUSKAL,   // Counting sort on weights 1..100 + union-find, O(E + V log V)
+    MST_BORUVKA    // Parallel Borůvka (pthreads); same forest as Kruskal
+} MSTAlgorithm;
+
 /**
  * Computes and prints the Minimum Spanning Tree (MST) of the graph using Prim’s algorithm.
  *
@@ -33,4 +72,39 @@
  */
 void primMST(Graph *g);
 
+/**
+ * Same MST computation and output as primMST, on a CSR snapshot.
+ *
+ * @param csr Snapshot produced by graph_freeze().
+ */
+void primMST_csr(const GraphCSR *csr);
+
+// Prim's algorithm on a snapshot; fills *out. Returns false on OOM.
+bool mst_prim_csr(const GraphCSR *csr, MSTResult *out);
+
+// Kruskal's algorithm on a snapshot; fills *out. Returns false on OOM or a
+// weight outside 1..100. Same total weight as Prim; on weight ties the edge
+// set may differ.
+bool mst_kruskal_csr(const GraphCSR *csr, MSTResult *out);
+
+// Parallel Borůvka on a snapshot with 'nthreads' workers (0 = one per CPU);
+// fills *out. Returns false on OOM or a weight outside 1..100. Breaks weight
+// ties by (lower, higher) endpoint index, so the edge set equals Kruskal's.
+bool mst_boruvka_csr(const GraphCSR *csr, int nthreads, MSTResult *out);
+
+// Run the selected engine. Returns false on NULL input, OOM or bad weights.
+bool mst_compute(const GraphCSR *csr, MSTAlgorithm algo, MSTResult *out);
+
+// Map "prim" / "kruskal" / "boruvka" to an engine. Returns false for any other name.
+bool mst_algorithm_from_name(const char *name, MSTAlgorithm *out);
+
+// Print a result in the primMST format.
+void mst_print(const MSTResult *r);
+
+// Compute with the selected engine and print it (prints nothing on failure).
+void mst_print_csr(const GraphCSR *csr, MSTAlgorithm algo);
+
+// Release the arrays owned by a result. Safe on NULL.
+void mst_result_free(MSTResult *r);
+
 #endif /* MST_H */
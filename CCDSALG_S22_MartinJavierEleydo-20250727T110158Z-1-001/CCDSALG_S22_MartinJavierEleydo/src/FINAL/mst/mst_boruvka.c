@@ -0,0 +1,278 @@
+/*
+ * FILE: mst_boruvka.c
+ * -------------------
+ * Parallel Borůvka MST on a CSR snapshot (pthreads), producing an MSTResult
+ * that prints in the primMST format via mst_print().
+ *
+ * Each round, every component picks its cheapest outgoing edge and all those
+ * edges are added at once; the number of components at least halves, so there
+ * are at most log2(V) rounds. Every phase of a round is a parallel loop over a
+ * slice of the vertices on a worker pool (worker_pool.c) started once per
+ * run; every phase completes before the next one is posted:
+ *
+ *   1. reset   : best[c] = NONE for every vertex
+ *   2. scan    : each vertex finds its cheapest edge leaving its component and
+ *                publishes it with an atomic min on best[comp[u]]
+ *   3. hook    : each component root c with an edge to root d sets
+ *                hook[c] = d and appends the edge (atomic slot counter); when
+ *                c and d picked the same edge, only the larger root hooks
+ *   4. jump    : pointer jumping on hook[] until every entry names its final
+ *                root (O(log depth) passes)
+ *   5. relabel : comp[u] = hook[comp[u]]
+ *
+ * Edges are totally ordered by (weight, lower endpoint, higher endpoint),
+ * packed into one 64-bit key so a single atomic compare-and-swap can take the
+ * minimum. A strict total order rules out cycles among equal-weight edges,
+ * and it is the same order mst_kruskal_csr processes edges in, so both
+ * engines return the same forest.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#include "graph.h"
+#include "worker_pool.h"
+#include "mst.h"
+
+#define BORUVKA_ID_BITS      28                       // Vertex index bits per key
+#define BORUVKA_MAX_VERTICES ((size_t)1 << BORUVKA_ID_BITS)
+#define BORUVKA_MAX_WEIGHT   100
+#define BORUVKA_NONE         UINT64_MAX               // "No edge" key
+#define BORUVKA_MIN_WORK     (1u << 15)               // Adjacency entries per thread
+
+// Edge key: weight (8 bits) | lower endpoint (28) | higher endpoint (28)
+static uint64_t edge_key(int w, uint32_t a, uint32_t b)
+{
+    uint32_t lo = a < b ? a : b, hi = a < b ? b : a;
+    return ((uint64_t)w << (2 * BORUVKA_ID_BITS)) | ((uint64_t)lo << BORUVKA_ID_BITS) | hi;
+}
+
+static uint32_t key_lo(uint64_t k) { return (uint32_t)(k >> BORUVKA_ID_BITS) & ((1u << BORUVKA_ID_BITS) - 1); }
+static uint32_t key_hi(uint64_t k) { return (uint32_t)k & ((1u << BORUVKA_ID_BITS) - 1); }
+static int      key_w(uint64_t k)  { return (int)(k >> (2 * BORUVKA_ID_BITS)); }
+
+// State shared by all threads of one run.
+typedef struct Boruvka {
+    const GraphCSR   *csr;
+    size_t            n;
+    int               nthreads;
+    size_t           *bounds;    // Thread t owns vertices [bounds[t], bounds[t+1])
+    uint32_t         *comp;      // Component root of every vertex
+    uint32_t         *hook;      // Root each component hooks to (then final root)
+    uint32_t         *hook_next; // Pointer-jumping double buffer
+    _Atomic uint64_t *best;      // Cheapest outgoing edge key per root
+    MSTEdge          *edges;     // Forest edges (unsorted until the end)
+    atomic_size_t     edge_count;
+    atomic_bool       changed;   // Pointer jumping: any entry moved this pass
+    atomic_bool       bad_weight;
+    WorkerPool       *pool;
+} Boruvka;
+
+typedef enum BoruvkaJob {
+    BORUVKA_RESET, BORUVKA_SCAN, BORUVKA_HOOK, BORUVKA_JUMP, BORUVKA_RELABEL
+} BoruvkaJob;
+
+typedef void (*PhaseFn)(Boruvka *b, size_t lo, size_t hi);
+
+// --- Phase 1: clear every best[] slot ---
+static void phase_reset(Boruvka *b, size_t lo, size_t hi)
+{
+    for (size_t c = lo; c < hi; ++c)
+        atomic_store_explicit(&b->best[c], BORUVKA_NONE, memory_order_relaxed);
+}
+
+// --- Phase 2: cheapest edge leaving each component ---
+static void phase_scan(Boruvka *b, size_t lo, size_t hi)
+{
+    const GraphCSR *csr = b->csr;
+    for (size_t u = lo; u < hi; ++u) {
+        uint32_t cu = b->comp[u];
+        uint64_t mine = BORUVKA_NONE;  // Vertex-local minimum: one atomic per vertex
+        for (size_t k = csr->offsets[u]; k < csr->offsets[u + 1]; ++k) {
+            uint32_t v = csr->adj[k];
+            if (b->comp[v] == cu) continue;
+            int w = csr->weights[k];
+            if (w < 1 || w > BORUVKA_MAX_WEIGHT) {
+                atomic_store_explicit(&b->bad_weight, true, memory_order_relaxed);
+                continue;
+            }
+            uint64_t key = edge_key(w, (uint32_t)u, v);
+            if (key < mine) mine = key;
+        }
+        if (mine == BORUVKA_NONE) continue;
+        uint64_t cur = atomic_load_explicit(&b->best[cu], memory_order_relaxed);
+        while (mine < cur &&
+               !atomic_compare_exchange_weak_explicit(&b->best[cu], &cur, mine,
+                                                      memory_order_relaxed,
+                                                      memory_order_relaxed))
+            ;
+    }
+}
+
+// --- Phase 3: hook each root along its cheapest edge ---
+static void phase_hook(Boruvka *b, size_t lo, size_t hi)
+{
+    for (size_t c = lo; c < hi; ++c) {
+        b->hook[c] = (uint32_t)c;
+        if (b->comp[c] != c) continue;                 // Not a root
+        uint64_t key = atomic_load_explicit(&b->best[c], memory_order_relaxed);
+        if (key == BORUVKA_NONE) continue;             // Component is complete
+        uint32_t x = key_lo(key), y = key_hi(key);
+        uint32_t d = (b->comp[x] == c) ? b->comp[y] : b->comp[x];
+        uint64_t back = atomic_load_explicit(&b->best[d], memory_order_relaxed);
+        if (back == key && c < d) continue;            // Mutual pick: d hooks to c
+        b->hook[c] = d;
+        size_t slot = atomic_fetch_add_explicit(&b->edge_count, 1, memory_order_relaxed);
+        b->edges[slot] = (MSTEdge){ x, y, key_w(key) };
+    }
+}
+
+// --- Phase 4: one pointer-jumping pass (hook_next = hook ∘ hook) ---
+static void phase_jump(Boruvka *b, size_t lo, size_t hi)
+{
+    bool moved = false;
+    for (size_t c = lo; c < hi; ++c) {
+        uint32_t h = b->hook[c], hh = b->hook[h];
+        b->hook_next[c] = hh;
+        if (hh != h) moved = true;
+    }
+    if (moved) atomic_store_explicit(&b->changed, true, memory_order_relaxed);
+}
+
+// --- Phase 5: move every vertex to its new root ---
+static void phase_relabel(Boruvka *b, size_t lo, size_t hi)
+{
+    for (size_t u = lo; u < hi; ++u) b->comp[u] = b->hook[b->comp[u]];
+}
+
+static const PhaseFn phase_fns[] = {
+    [BORUVKA_RESET]   = phase_reset,
+    [BORUVKA_SCAN]    = phase_scan,
+    [BORUVKA_HOOK]    = phase_hook,
+    [BORUVKA_JUMP]    = phase_jump,
+    [BORUVKA_RELABEL] = phase_relabel,
+};
+
+// Slice t of 'parts' (WorkerSliceFn): bounds[] slices t*nthreads/parts up to
+// (t+1)*nthreads/parts, i.e. one slice each, or all of them run inline.
+static void phase_slice(void *ctx, int job, int t, int parts)
+{
+    Boruvka *b = ctx;
+    int first = t * b->nthreads / parts, last = (t + 1) * b->nthreads / parts;
+    phase_fns[job](b, b->bounds[first], b->bounds[last]);
+}
+
+// Run one phase over every thread's vertex slice and wait for all of them.
+static void run_phase(Boruvka *b, BoruvkaJob job)
+{
+    worker_pool_run(b->pool, job, b->n, 0);
+}
+
+// qsort comparator: by (u, v) index, i.e. lexicographic order
+static int cmp_edge(const void *pa, const void *pb)
+{
+    const MSTEdge *a = pa, *b = pb;
+    if (a->u != b->u) return (a->u < b->u) ? -1 : 1;
+    if (a->v != b->v) return (a->v < b->v) ? -1 : 1;
+    return 0;
+}
+
+// Split vertices so each thread gets about the same number of adjacency entries.
+static void split_by_edges(const GraphCSR *csr, int nthreads, size_t *bounds)
+{
+    bounds[0] = 0;
+    for (int t = 1; t < nthreads; ++t) {
+        size_t target = csr->m / (size_t)nthreads * (size_t)t;
+        size_t lo = bounds[t - 1], hi = csr->n;   // First vertex with offsets >= target
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (csr->offsets[mid] < target) lo = mid + 1;
+            else                            hi = mid;
+        }
+        bounds[t] = lo;
+    }
+    bounds[nthreads] = csr->n;
+}
+
+/*
+ * FUNCTION: mst_boruvka_csr
+ * -------------------------
+ * Parameters:
+ *   - csr     : snapshot produced by graph_freeze() or graph_open_mmap()
+ *   - nthreads: worker count (at most 64); 0 picks one per online CPU, lowered
+ *               so each thread scans at least BORUVKA_MIN_WORK entries
+ *   - out     : filled on success; release with mst_result_free()
+ *
+ * Graphs with more than 2^28 vertices do not fit the packed edge key and are
+ * handed to mst_kruskal_csr, which returns the same forest.
+ * Returns false on OOM or a weight outside 1..100.
+ */
+bool mst_boruvka_csr(const GraphCSR *csr, int nthreads, MSTResult *out)
+{
+    memset(out, 0, sizeof *out);
+    if (!csr) return false;
+    if (csr->n > BORUVKA_MAX_VERTICES) return mst_kruskal_csr(csr, out);
+
+    // --- Thread count and allocation ---
+    nthreads = worker_pool_threads(nthreads, csr->m, BORUVKA_MIN_WORK);
+    size_t n = csr->n;
+    Boruvka b;
+    memset(&b, 0, sizeof b);
+    b.csr = csr;
+    b.n = n;
+    b.nthreads = nthreads;
+    b.bounds    = malloc(((size_t)nthreads + 1) * sizeof(size_t));
+    b.comp      = malloc((n ? n : 1) * sizeof(uint32_t));
+    b.hook      = malloc((n ? n : 1) * sizeof(uint32_t));
+    b.hook_next = malloc((n ? n : 1) * sizeof(uint32_t));
+    b.best      = malloc((n ? n : 1) * sizeof(_Atomic uint64_t));
+    b.edges     = malloc((n ? n : 1) * sizeof(MSTEdge));
+    const char **names = malloc((n ? n : 1) * sizeof(const char *));
+    bool ok = b.bounds && b.comp && b.hook && b.hook_next && b.best && b.edges && names;
+    b.pool = ok ? worker_pool_create(nthreads, phase_slice, &b) : NULL;
+    ok = b.pool != NULL;
+
+    if (ok) {
+        memcpy(names, csr->names, n * sizeof(const char *));
+        for (size_t u = 0; u < n; ++u) b.comp[u] = (uint32_t)u;
+        atomic_init(&b.edge_count, 0);
+        atomic_init(&b.changed, false);
+        atomic_init(&b.bad_weight, false);
+        split_by_edges(csr, nthreads, b.bounds);
+
+        // --- Rounds: stop when no component found an outgoing edge ---
+        for (;;) {
+            size_t before = atomic_load(&b.edge_count);
+            run_phase(&b, BORUVKA_RESET);
+            run_phase(&b, BORUVKA_SCAN);
+            if (atomic_load(&b.bad_weight)) { ok = false; break; }
+            run_phase(&b, BORUVKA_HOOK);
+            if (atomic_load(&b.edge_count) == before) break;
+            do {
+                atomic_store(&b.changed, false);
+                run_phase(&b, BORUVKA_JUMP);
+                uint32_t *t = b.hook; b.hook = b.hook_next; b.hook_next = t;
+            } while (atomic_load(&b.changed));
+            run_phase(&b, BORUVKA_RELABEL);
+        }
+    }
+
+    worker_pool_destroy(b.pool);
+    size_t edge_count = atomic_load(&b.edge_count);
+    free(b.bounds); free(b.comp); free(b.hook); free(b.hook_next); free(b.best);
+    if (!ok) { free(b.edges); free(names); return false; }
+
+    long total = 0;
+    for (size_t i = 0; i < edge_count; ++i) total += b.edges[i].weight;
+    qsort(b.edges, edge_count, sizeof(MSTEdge), cmp_edge);
+    out->n = n;
+    out->names = names;
+    out->edges = b.edges;
+    out->edge_count = edge_count;
+    out->total_weight = total;
+    return true;
+}
@@ -10,6 +10,32 @@
  *   - Repeatedly selects the closest unvisited vertex and "relaxes" its neighbors.
  *   - Remembers the best parent for each vertex to reconstruct the path.
  *
+ * Engine (sp_dijkstra):
+ *   - The closest vertex comes from an IndexedHeap (real decrease-key), and
+ *     each settled vertex walks its own adjacency list exactly once, so a run
+ *     costs O((V + E) log V) instead of O(V²) edge-weight lookups.
+ *   - Distances and parents are returned in a ShortestPathTree so other
+ *     modules can reuse them; shortestPath() only formats the result.
+ *   - sp_dijkstra_csr runs on a GraphCSR snapshot (contiguous neighbor
+ *     rows); sp_dijkstra runs the same search on the live graph through
+ *     its public id/neighbor API.
+ *
+ * Engine (sp_dial_csr):
+ *   - Edge weights are integers in 1..100, so pending vertices are kept in a
+ *     circular array of 101 distance buckets (Dial's algorithm) and settled
+ *     in bucket order: O(E + V·C) with no key comparisons.
+ *   - Same ShortestPathTree as sp_dijkstra_csr, parents included.
+ *
+ * Engine (sp_delta_stepping_csr, sp_delta.c):
+ *   - Multithreaded delta-stepping for very large graphs; same tree.
+ *
+ * Engine (sp_bidirectional_csr, the command-9 default):
+ *   - Point-to-point: a forward search from 'start' and a backward search
+ *     from 'end' take turns and stop as soon as their frontiers prove the
+ *     best meeting cost, instead of settling the source's whole component.
+ *   - Only the printed path is reconstructed, with the same parents the
+ *     single-source engines pick.
+ *
  * Output:
  *   - If a path exists: prints the path in "A -> B -> C" format and total cost
  *   - If no path exists or a vertex is invalid: prints "0"
@@ -21,13 +47,18 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
 #include <limits.h>
 #include "graph.h"
+#include "heap.h"
 #include "shortest_Path.h"
 
-#define MAX_V 100
-#define INF 999999
+#define INF SP_INF
+
+#define SP_MAX_WEIGHT  100                  // Snapshot weights are 1..100 (GraphCSR)
+#define SP_DIAL_BUCKETS (SP_MAX_WEIGHT + 1) // Pending distances span d..d+100
 
 /*
  * Helper: minDistance
@@ -36,6 +67,7 @@
  * distance. Returns its index (or -1 if none left).
  *
  * Pattern: Classic Dijkstra with array-based implementation (no heap).
+ * Kept for API compatibility; sp_dijkstra uses the indexed heap instead.
  */
 int minDistance(int dist[], int visited[], int n) {
     int min = INF, min_index = -1;
@@ -48,73 +80,571 @@ int minDistance(int dist[], int visited[], int n) {
     return min_index;
 }
 
+// Relax edge u -> v (weight w) for the heap engines, u settled at du.
+// Equal-cost rule: the parent switches to u only when u is as close to the
+// source as the current parent and later in lex order.
+static void sp_relax(ShortestPathTree *t, IndexedHeap *pq, int u, int du, int v, int w)
+{
+    int nd = du + w;
+    if (nd < t->dist[v]) {
+        bool queued = t->dist[v] != INF;
+        t->dist[v] = nd;
+        t->parent[v] = u;
+        if (queued) iheap_decrease_key(pq, (size_t)v, nd);
+        else        iheap_push(pq, (size_t)v, nd);
+    } else if (nd == t->dist[v] && u > t->parent[v] && t->dist[t->parent[v]] == du) {
+        t->parent[v] = u;
+    }
+}
+
 /*
- * Main function: shortestPath
- * ---------------------------
- * Implements Dijkstra’s algorithm for the shortest path.
- * Handles all edge/error cases as required by the DSAL project spec.
+ * Function: sp_dijkstra_csr
+ * -------------------------
+ * Heap-driven Dijkstra over a CSR snapshot.
+ *   - A vertex enters the heap when first reached and is lowered with
+ *     iheap_decrease_key when a shorter path is found.
+ *   - Each settled vertex scans its contiguous neighbor row once.
+ *   - On an equal-cost relaxation the parent switches to u only when u is as
+ *     close to the source as the current parent and later in lex order, which
+ *     reproduces the parents the original array scan (ties: highest index
+ *     first) produced, independent of heap tie order.
  */
-void shortestPath(Graph *g, const char *start, const char *end) {
-    // --- Step 1: Get all vertices in the graph (by name, for index mapping) ---
-    char names[MAX_V][256];
-    int n = graph_get_all_vertices(g, names);
+bool sp_dijkstra_csr(const GraphCSR *csr, const char *source, ShortestPathTree *out)
+{
+    if (!out) return false;
+    memset(out, 0, sizeof *out);
+    out->source = -1;
+    if (!csr || !source) return false;
 
-    // --- Step 2: Initialize Dijkstra arrays ---
-    int dist[MAX_V], visited[MAX_V] = {0}, parent[MAX_V];
-    for (int i = 0; i < n; i++) {
-        dist[i] = INF;      // All distances unknown (infinity)
-        parent[i] = -1;     // No path found yet
+    long s = graph_csr_index_of(csr, source);
+    if (s < 0) return false;
+
+    // --- Step 1: Allocate the tree and scratch (vertex order = CSR order) ---
+    size_t n = csr->n;
+    out->names  = malloc(n * sizeof(const char *));
+    out->dist   = malloc(n * sizeof(int));
+    out->parent = malloc(n * sizeof(int));
+    char *done  = calloc(n, 1);
+    IndexedHeap *pq = iheap_create(n);
+    if (!out->names || !out->dist || !out->parent || !done || !pq) {
+        free(done);
+        iheap_destroy(pq);
+        sp_tree_free(out);
+        return false;
     }
+    for (size_t i = 0; i < n; i++) {
+        out->names[i] = csr->names[i];
+        out->dist[i] = INF;
+        out->parent[i] = -1;
+    }
+    out->n = n;
+    out->source = (int)s;
+    out->dist[s] = 0;
+    iheap_push(pq, (size_t)s, 0);
 
-    // --- Step 3: Map start and end vertex names to indices ---
-    int startIndex = -1, endIndex = -1;
-    for (int i = 0; i < n; i++) {
-        if (strcmp(names[i], start) == 0) startIndex = i;
-        if (strcmp(names[i], end) == 0) endIndex = i;
+    // --- Step 2: Settle vertices in order of distance ---
+    while (!iheap_is_empty(pq)) {
+        int du;
+        int u = (int)iheap_extract_min(pq, &du);
+        done[u] = 1;
+
+        for (size_t k = csr->offsets[u]; k < csr->offsets[u + 1]; k++) {
+            int v = (int)csr->adj[k];
+            if (!done[v]) sp_relax(out, pq, u, du, v, csr->weights[k]);
+        }
     }
 
-    // --- Step 4: If either start or end does not exist, output "0" ---
-    if (startIndex == -1 || endIndex == -1) {
-        printf("0\n");
-        return;
+    free(done);
+    iheap_destroy(pq);
+    return true;
+}
+
+/*
+ * Function: sp_dial_csr
+ * ---------------------
+ * Dial's algorithm over a CSR snapshot.
+ *   - Every reached, unsettled vertex sits in bucket dist % 101, a doubly
+ *     linked list threaded through next[]/prev[]; lowering a distance moves
+ *     the vertex between buckets in O(1).
+ *   - While bucket d is drained, relaxations only reach d+1..d+100, which
+ *     map to the other 100 buckets, so one array of 101 never overflows.
+ *   - Relaxation and the equal-cost parent rule are those of
+ *     sp_dijkstra_csr, so the tree is identical.
+ */
+bool sp_dial_csr(const GraphCSR *csr, const char *source, ShortestPathTree *out)
+{
+    if (!out) return false;
+    memset(out, 0, sizeof *out);
+    out->source = -1;
+    if (!csr || !source) return false;
+
+    long s = graph_csr_index_of(csr, source);
+    if (s < 0) return false;
+
+    // --- Step 1: Allocate the tree and the bucket lists ---
+    size_t n = csr->n;
+    out->names  = malloc(n * sizeof(const char *));
+    out->dist   = malloc(n * sizeof(int));
+    out->parent = malloc(n * sizeof(int));
+    int *next   = malloc(n * sizeof(int));
+    int *prev   = malloc(n * sizeof(int));
+    char *done  = calloc(n, 1);
+    int head[SP_DIAL_BUCKETS];
+    if (!out->names || !out->dist || !out->parent || !next || !prev || !done) {
+        free(next); free(prev); free(done);
+        sp_tree_free(out);
+        return false;
     }
+    for (size_t i = 0; i < n; i++) {
+        out->names[i] = csr->names[i];
+        out->dist[i] = INF;
+        out->parent[i] = -1;
+    }
+    for (int b = 0; b < SP_DIAL_BUCKETS; b++) head[b] = -1;
+    out->n = n;
+    out->source = (int)s;
+    out->dist[s] = 0;
+    head[0] = (int)s;
+    next[s] = prev[s] = -1;
+    size_t pending = 1;
 
-    dist[startIndex] = 0; // Start vertex has zero cost to itself
+    // --- Step 2: Drain buckets in distance order ---
+    for (int d = 0; pending > 0; d++) {
+        int *bucket = &head[d % SP_DIAL_BUCKETS];
+        while (*bucket != -1) {
+            int u = *bucket;             // Pop the front of bucket d
+            *bucket = next[u];
+            if (next[u] != -1) prev[next[u]] = -1;
+            pending--;
+            done[u] = 1;
 
-    // --- Step 5: Main Dijkstra loop (repeat for all vertices) ---
-    for (int count = 0; count < n - 1; count++) {
-        // Find the closest unvisited vertex
-        int u = minDistance(dist, visited, n);
-        if (u == -1) break; // All reachable nodes have been visited
+            for (size_t k = csr->offsets[u]; k < csr->offsets[u + 1]; k++) {
+                int v = (int)csr->adj[k];
+                if (done[v]) continue;
+                int nd = d + csr->weights[k];
+                if (nd < out->dist[v]) {
+                    if (out->dist[v] != INF) {   // Unlink from its old bucket
+                        if (prev[v] != -1) next[prev[v]] = next[v];
+                        else head[out->dist[v] % SP_DIAL_BUCKETS] = next[v];
+                        if (next[v] != -1) prev[next[v]] = prev[v];
+                    } else {
+                        pending++;
+                    }
+                    int *h = &head[nd % SP_DIAL_BUCKETS];
+                    prev[v] = -1;
+                    next[v] = *h;
+                    if (*h != -1) prev[*h] = v;
+                    *h = v;
+                    out->dist[v] = nd;
+                    out->parent[v] = u;
+                } else if (nd == out->dist[v] && u > out->parent[v] &&
+                           out->dist[out->parent[v]] == d) {
+                    out->parent[v] = u;
+                }
+            }
+        }
+    }
 
-        visited[u] = 1; // Mark as processed
+    free(next);
+    free(prev);
+    free(done);
+    return true;
+}
 
-        // Try relaxing all neighbors of u
-        for (int v = 0; v < n; v++) {
-            int weight = graph_get_edge_weight(g, names[u], names[v]);
-            // If (v) is not visited, there is an edge, and path through u is shorter
-            if (!visited[v] && weight > 0 && dist[u] + weight < dist[v]) {
-                dist[v] = dist[u] + weight;
-                parent[v] = u; // Record that best path to v is through u
+// Bidirectional search state: one direction's labels, settled marks and queue.
+typedef struct SPSide {
+    int         *dist;    // Tentative distance from this side's root (INF if unreached)
+    char        *done;    // 1 once settled
+    IndexedHeap *pq;
+} SPSide;
+
+// Key of a side's next vertex, INF if its queue is empty.
+static int side_top(const SPSide *side)
+{
+    int key = INF;
+    iheap_peek_min(side->pq, &key);
+    return key;
+}
+
+/*
+ * Helper: side_settle
+ * -------------------
+ * Settles the closest queued vertex of 'side' and relaxes its row. If
+ * 'other' is given, every relaxed edge that reaches a vertex the other side
+ * has labelled is a candidate meeting and may lower *best.
+ */
+static void side_settle(const GraphCSR *csr, SPSide *side, const SPSide *other,
+                        long *best)
+{
+    int du;
+    int u = (int)iheap_extract_min(side->pq, &du);
+    side->done[u] = 1;
+    for (size_t k = csr->offsets[u]; k < csr->offsets[u + 1]; k++) {
+        int v = (int)csr->adj[k];
+        if (side->done[v]) continue;
+        int nd = du + csr->weights[k];
+        if (nd < side->dist[v]) {
+            bool queued = side->dist[v] != INF;
+            side->dist[v] = nd;
+            if (queued) iheap_decrease_key(side->pq, (size_t)v, nd);
+            else        iheap_push(side->pq, (size_t)v, nd);
+        }
+        if (other && other->dist[v] != INF && (long)nd + other->dist[v] < *best)
+            *best = (long)nd + other->dist[v];
+    }
+}
+
+/*
+ * Function: sp_bidirectional_csr
+ * ------------------------------
+ * Bidirectional Dijkstra from 'source' to 'target' on a CSR snapshot.
+ *
+ * Fills *out as a ShortestPathTree in which only the vertices of the printed
+ * path carry dist/parent (every other vertex is SP_INF / -1), so
+ * sp_print_path(out, target) prints exactly what the single-source engines
+ * print. Returns false if either vertex is missing or on OOM.
+ *
+ *   1. Search: expand whichever side has the smaller queue key and track the
+ *      best meeting cost D; stop once top_f + top_b >= D.
+ *   2. Exact labels: the path walk needs the exact forward distance of every
+ *      vertex on some shortest path. Vertices settled forward already have it;
+ *      the forward search is resumed up to D, skipping vertices whose
+ *      distance plus a lower bound on the remaining distance (exact backward
+ *      label if settled, else the backward queue key) exceeds D. That only
+ *      visits the shortest-path subgraph near the target.
+ *   3. Path walk from target: the parent of v is the neighbour u with
+ *      dist_f[u] + w(u, v) == dist_f[v] and the smallest dist_f[u] (the
+ *      heaviest such edge), ties going to the greater index. This is the
+ *      single-source engines' parent rule. A label is never below the true
+ *      distance, so a match is always a real tight edge.
+ */
+bool sp_bidirectional_csr(const GraphCSR *csr, const char *source, const char *target,
+                          ShortestPathTree *out)
+{
+    if (!out) return false;
+    memset(out, 0, sizeof *out);
+    out->source = -1;
+    if (!csr || !source || !target) return false;
+
+    long s = graph_csr_index_of(csr, source);
+    long t = graph_csr_index_of(csr, target);
+    if (s < 0 || t < 0) return false;
+
+    // --- Allocate the (path-only) tree and both search sides ---
+    size_t n = csr->n;
+    out->names  = malloc(n * sizeof(const char *));
+    out->dist   = malloc(n * sizeof(int));
+    out->parent = malloc(n * sizeof(int));
+    SPSide fwd = { malloc(n * sizeof(int)), calloc(n, 1), iheap_create(n) };
+    SPSide bwd = { malloc(n * sizeof(int)), calloc(n, 1), iheap_create(n) };
+    bool ok = out->names && out->dist && out->parent &&
+              fwd.dist && fwd.done && fwd.pq && bwd.dist && bwd.done && bwd.pq;
+
+    if (ok) {
+        for (size_t i = 0; i < n; i++) {
+            out->names[i] = csr->names[i];
+            out->dist[i] = fwd.dist[i] = bwd.dist[i] = INF;
+            out->parent[i] = -1;
+        }
+        out->n = n;
+        out->source = (int)s;
+        fwd.dist[s] = 0;
+        bwd.dist[t] = 0;
+        iheap_push(fwd.pq, (size_t)s, 0);
+        iheap_push(bwd.pq, (size_t)t, 0);
+        long best = (s == t) ? 0 : INF;
+
+        // --- Step 1: Alternate until the frontiers prove 'best' ---
+        while (!iheap_is_empty(fwd.pq) && !iheap_is_empty(bwd.pq)) {
+            int kf = side_top(&fwd), kb = side_top(&bwd);
+            if ((long)kf + kb >= best) break;
+            if (kf <= kb) side_settle(csr, &fwd, &bwd, &best);
+            else          side_settle(csr, &bwd, &fwd, &best);
+        }
+
+        if (best != INF) {
+            // --- Step 2: Exact forward labels on the shortest-path subgraph ---
+            int kb = side_top(&bwd);
+            int dk;
+            while (iheap_peek_min(fwd.pq, &dk) != SIZE_MAX && dk <= best) {
+                size_t u = iheap_peek_min(fwd.pq, NULL);
+                long rest = bwd.done[u] ? bwd.dist[u] : kb;
+                if ((long)dk + rest > best) {      // Not on any shortest path
+                    iheap_extract_min(fwd.pq, NULL);
+                    fwd.done[u] = 1;
+                    continue;
+                }
+                side_settle(csr, &fwd, NULL, NULL);
+            }
+
+            // --- Step 3: Walk the tight edges back from the target ---
+            int v = (int)t, dv = (int)best;
+            out->dist[v] = dv;
+            while (v != s) {
+                int pick = -1, pick_w = 0;
+                for (size_t k = csr->offsets[v]; k < csr->offsets[v + 1]; k++) {
+                    int u = (int)csr->adj[k], w = csr->weights[k];
+                    if (fwd.dist[u] != dv - w) continue;
+                    if (w > pick_w || (w == pick_w && u > pick)) { pick = u; pick_w = w; }
+                }
+                out->parent[v] = pick;
+                v = pick;
+                dv -= pick_w;
+                out->dist[v] = dv;
             }
         }
     }
 
-    // --- Step 6: If no path to destination, output "0" ---
-    if (dist[endIndex] == INF) {
+    free(fwd.dist); free(fwd.done); iheap_destroy(fwd.pq);
+    free(bwd.dist); free(bwd.done); iheap_destroy(bwd.pq);
+    if (!ok) {
+        sp_tree_free(out);
+        return false;
+    }
+    return true;
+}
+
+// Run the selected engine on a snapshot.
+bool sp_tree_csr(const GraphCSR *csr, const char *source, SPEngine engine,
+                 ShortestPathTree *out)
+{
+    switch (engine) {
+        case SP_ENGINE_HEAP:  return sp_dijkstra_csr(csr, source, out);
+        case SP_ENGINE_DIAL:  return sp_dial_csr(csr, source, out);
+        case SP_ENGINE_BIDIR: break;   // Needs a target: see sp_print_csr
+        case SP_ENGINE_ALT:   break;
+        case SP_ENGINE_DELTA: return sp_delta_stepping_csr(csr, source, 0, 0, out);
+        case SP_ENGINE_CH:    break;
+    }
+    if (out) {
+        memset(out, 0, sizeof *out);
+        out->source = -1;
+    }
+    return false;
+}
+
+// Parse an engine name ("heap", "dial", "bidir", "alt", "delta" or "ch").
+bool sp_engine_from_name(const char *name, SPEngine *out)
+{
+    if (!name) return false;
+    if (strcmp(name, "heap") == 0) { *out = SP_ENGINE_HEAP; return true; }
+    if (strcmp(name, "dial") == 0) { *out = SP_ENGINE_DIAL; return true; }
+    if (strcmp(name, "bidir") == 0) { *out = SP_ENGINE_BIDIR; return true; }
+    if (strcmp(name, "alt") == 0)   { *out = SP_ENGINE_ALT;   return true; }
+    if (strcmp(name, "delta") == 0) { *out = SP_ENGINE_DELTA; return true; }
+    if (strcmp(name, "ch") == 0)    { *out = SP_ENGINE_CH;    return true; }
+    return false;
+}
+
+/*
+ * Function: sp_dijkstra
+ * ---------------------
+ * sp_dijkstra_csr on the live graph through its public API, with no
+ * snapshot: vertex i is the i-th name (graph_get_vertex_names), rank[id]
+ * maps a neighbor id to that index, and each settled vertex walks its
+ * adjacency in place (graph_neighbors_begin/next). Neighbors arrive in name
+ * order, as in a CSR row, so the tree is identical.
+ */
+bool sp_dijkstra(Graph *g, const char *source, ShortestPathTree *out)
+{
+    if (!out) return false;
+    memset(out, 0, sizeof *out);
+    out->source = -1;
+    if (!g || !source) return false;
+
+    VertexId s_id = graph_vertex_id(g, source);
+    if (s_id == GRAPH_NO_VERTEX) return false;
+
+    // --- Step 1: Name-order numbering, tree and scratch ---
+    size_t n = graph_vertex_count(g);
+    out->names = malloc(n * sizeof(const char *));
+    out->dist  = malloc(n * sizeof(int));
+    out->parent = malloc(n * sizeof(int));
+    VertexId *ids = malloc(n * sizeof(VertexId));   // ids[i]: id of the i-th name
+    int *rank   = malloc(n * sizeof(int));          // rank[id]: index of id
+    char *done  = calloc(n, 1);
+    IndexedHeap *pq = iheap_create(n);
+    if (!out->names || !out->dist || !out->parent || !ids || !rank || !done || !pq) {
+        free(ids); free(rank); free(done);
+        iheap_destroy(pq);
+        sp_tree_free(out);
+        return false;
+    }
+    graph_get_vertex_names(g, out->names);
+    graph_get_vertex_ids(g, ids);
+    for (size_t i = 0; i < n; i++) {
+        rank[ids[i]] = (int)i;
+        out->dist[i] = INF;
+        out->parent[i] = -1;
+    }
+    int s = rank[s_id];
+    out->n = n;
+    out->source = s;
+    out->dist[s] = 0;
+    iheap_push(pq, (size_t)s, 0);
+
+    // --- Step 2: Settle vertices in order of distance ---
+    while (!iheap_is_empty(pq)) {
+        int du;
+        int u = (int)iheap_extract_min(pq, &du);
+        done[u] = 1;
+
+        GraphNeighborIter it;
+        graph_neighbors_begin(g, ids[u], &it);
+        for (const GraphNeighbor *nb; (nb = graph_neighbors_next(&it)); ) {
+            int v = rank[nb->id];
+            if (!done[v]) sp_relax(out, pq, u, du, v, nb->weight);
+        }
+    }
+
+    free(ids); free(rank); free(done);
+    iheap_destroy(pq);
+    return true;
+}
+
+/*
+ * Function: sp_tree_free
+ * ----------------------
+ * Frees the arrays owned by the tree (names point into the graph).
+ */
+void sp_tree_free(ShortestPathTree *t)
+{
+    if (!t) return;
+    free(t->names);
+    free(t->dist);
+    free(t->parent);
+    t->names = NULL;
+    t->dist = t->parent = NULL;
+    t->n = 0;
+    t->source = -1;
+}
+
+/*
+ * Function: sp_tree_index_of
+ * --------------------------
+ * Binary search over the tree's (sorted) names.
+ */
+int sp_tree_index_of(const ShortestPathTree *t, const char *name)
+{
+    if (!t || !name) return -1;
+    size_t lo = 0, hi = t->n;
+    while (lo < hi) {
+        size_t mid = (lo + hi) >> 1;
+        int cmp = strcmp(t->names[mid], name);
+        if (cmp == 0) return (int)mid;
+        (cmp < 0) ? (lo = mid + 1) : (hi = mid);
+    }
+    return -1;
+}
+
+/*
+ * Function: sp_print_path
+ * -----------------------
+ * Reconstructs the path source -> dst from parent[] and prints it in the
+ * required "A -> B -> C; Total edge cost = N" format ("0" if unreachable).
+ */
+void sp_print_path(const ShortestPathTree *t, int dst)
+{
+    if (!t || dst < 0 || (size_t)dst >= t->n || t->dist[dst] == INF) {
         printf("0\n");
         return;
     }
 
-    // --- Step 7: Reconstruct path from endIndex back to startIndex ---
-    int path[MAX_V], len = 0;
-    for (int v = endIndex; v != -1; v = parent[v])
+    // Walk back to the source, then print in forward order
+    int *path = malloc(t->n * sizeof(int));
+    if (!path) { printf("0\n"); return; }
+    int len = 0;
+    for (int v = dst; v != -1; v = t->parent[v])
         path[len++] = v;
 
-    // --- Step 8: Print path in required format ---
     for (int i = len - 1; i >= 0; i--) {
-        printf("%s", names[path[i]]);
+        printf("%s", t->names[path[i]]);
         if (i != 0) printf(" -> ");
     }
-    printf("; Total edge cost = %d\n", dist[endIndex]);
+    printf("; Total edge cost = %d\n", t->dist[dst]);
+    free(path);
+}
+
+/*
+ * Function: sp_path_print / sp_path_free
+ * --------------------------------------
+ * Same "A -> B -> C; Total edge cost = N" line as sp_print_path, for an
+ * SPPath from a point-to-point engine.
+ */
+void sp_path_print(const GraphCSR *csr, const SPPath *p)
+{
+    if (!csr || !p || p->len == 0) {
+        printf("0\n");
+        return;
+    }
+    for (size_t i = 0; i < p->len; i++) {
+        printf("%s", csr->names[p->vertices[i]]);
+        if (i + 1 != p->len) printf(" -> ");
+    }
+    printf("; Total edge cost = %d\n", p->cost);
+}
+
+void sp_path_free(SPPath *p)
+{
+    if (!p) return;
+    free(p->vertices);
+    p->vertices = NULL;
+    p->len = 0;
+    p->cost = 0;
+}
+
+/*
+ * Main function: shortestPath
+ * ---------------------------
+ * Command 9 on the live graph: sp_dijkstra from 'start', then the path to
+ * 'end'. No snapshot is built; the line matches the snapshot engines'.
+ * Handles all edge/error cases as required by the DSAL project spec.
+ */
+void shortestPath(Graph *g, const char *start, const char *end) {
+    ShortestPathTree t;
+    if (!end || !sp_dijkstra(g, start, &t)) {
+        printf("0\n");
+        return;
+    }
+    sp_print_path(&t, sp_tree_index_of(&t, end));
+    sp_tree_free(&t);
+}
+
+/*
+ * Function: shortestPath_csr
+ * --------------------------
+ * Command 9 on a CSR snapshot; output identical to shortestPath.
+ */
+void shortestPath_csr(const GraphCSR *csr, const char *start, const char *end) {
+    sp_print_csr(csr, start, end, SP_ENGINE_BIDIR);
+}
+
+/*
+ * Function: sp_print_csr
+ * ----------------------
+ * Command 9 with an explicit engine. All engines agree on the parents along
+ * the path, so the printed line does not depend on the choice.
+ */
+void sp_print_csr(const GraphCSR *csr, const char *start, const char *end,
+                  SPEngine engine) {
+    if (engine == SP_ENGINE_ALT) {   // One-off table; main keeps one per snapshot
+        SPLandmarks *lm = sp_landmarks_build(csr, SP_ALT_DEFAULT_LANDMARKS);
+        if (lm) {
+            sp_alt_print(lm, start, end);
+            sp_landmarks_destroy(lm);
+            return;
+        }
+        engine = SP_ENGINE_BIDIR;
+    }
+    if (engine == SP_ENGINE_CH) engine = SP_ENGINE_BIDIR;   // Index lives in main
+    ShortestPathTree t;
+    bool ok = (engine == SP_ENGINE_BIDIR)
+            ? sp_bidirectional_csr(csr, start, end, &t)
+            : sp_tree_csr(csr, start, engine, &t);
+    if (!end || !ok) {
+        printf("0\n");
+        return;
+    }
+    sp_print_path(&t, sp_tree_index_of(&t, end));
+    sp_tree_free(&t);
 }
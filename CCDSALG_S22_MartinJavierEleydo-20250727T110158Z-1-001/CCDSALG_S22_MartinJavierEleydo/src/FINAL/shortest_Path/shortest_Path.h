@@ -1,9 +1,193 @@
 #ifndef SHORTEST_PATH_H
 #define SHORTEST_PATH_H
 
+#include <stdio.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <limits.h>
 #include "graph.h"
 
+// Distance reported for vertices unreachable from the source. INT_MAX leaves
+// room for real path costs on large graphs (100 per edge, ~10^7 vertices).
+#define SP_INF INT_MAX
+
+/*
+ * ShortestPathTree
+ * ----------------
+ * Result of a single-source shortest path run. Vertices are numbered
+ * 0..n-1 in lexicographic order of their names (the graph's storage order).
+ *   - names[i]  : name of vertex i (borrowed from the graph; do not free)
+ *   - dist[i]   : cost of the shortest path source -> i, or SP_INF
+ *   - parent[i] : predecessor of i on that path, -1 for the source/unreachable
+ * Among equally short paths, parent[i] is the predecessor with the smallest
+ * distance, ties going to the lexicographically greatest name; this is the
+ * path the original array-scan Dijkstra printed.
+ */
+typedef struct ShortestPathTree {
+    size_t       n;
+    int          source;
+    const char **names;
+    int         *dist;
+    int         *parent;
+} ShortestPathTree;
+
+// Single-source engines selectable at runtime (see sp_engine_from_name).
+typedef enum SPEngine {
+    SP_ENGINE_HEAP,   // Indexed binary heap, O((V + E) log V)
+    SP_ENGINE_DIAL,   // 101 circular distance buckets, O(E + V·C), C = 100
+    SP_ENGINE_BIDIR,  // Bidirectional Dijkstra; point-to-point only (sp_print_csr)
+    SP_ENGINE_ALT,    // A* with landmark bounds (sp_alt.c); point-to-point only
+    SP_ENGINE_DELTA,  // Parallel delta-stepping (sp_delta.c), default width/threads
+    SP_ENGINE_CH      // Contraction hierarchy index (contraction.c); point-to-point only
+} SPEngine;
+
+// Bucket width for sp_delta_stepping_csr when the caller passes delta <= 0.
+#define SP_DELTA_DEFAULT 16
+
+/*
+ * SPPath
+ * ------
+ * One source -> target path from a point-to-point engine.
+ *   - vertices : snapshot indices, source first (owned; NULL when len is 0)
+ *   - len      : number of vertices, 0 when the target is unreachable
+ *   - cost     : total edge weight
+ */
+typedef struct SPPath {
+    int    *vertices;
+    size_t  len;
+    int     cost;
+} SPPath;
+
+// Landmark table for ALT queries (sp_alt.c). Borrows the snapshot it was
+// built from; rebuild it whenever the graph changes.
+typedef struct SPLandmarks SPLandmarks;
+
+#define SP_ALT_DEFAULT_LANDMARKS 8
+
+// LRU of recent single-source trees of one snapshot (sp_batch.c). Borrows the
+// snapshot; destroy it whenever the graph changes.
+typedef struct SPTreeCache SPTreeCache;
+
+#define SP_TREE_CACHE_DEFAULT 4
+
+/*
+ * SPDistanceMatrix
+ * ----------------
+ * All-pairs result of sp_apsp (sp_apsp.c), indexed like the snapshot.
+ *   - names           : name of vertex i (array owned, strings borrowed)
+ *   - dist[i*stride+j]: cost of the shortest path i -> j, or SP_INF
+ *   - stride          : row pitch in ints (n rounded up to the block size)
+ */
+typedef struct SPDistanceMatrix {
+    size_t       n;
+    size_t       stride;
+    const char **names;
+    int         *dist;
+} SPDistanceMatrix;
+
+// Min-plus kernels for sp_apsp_csr_kernel. AUTO picks the widest one the CPU runs.
+typedef enum SPApspKernel {
+    SP_APSP_AUTO,
+    SP_APSP_SCALAR,
+    SP_APSP_SSE41,
+    SP_APSP_AVX2
+} SPApspKernel;
+
 int minDistance(int dist[], int visited[], int n);
+
+// Run Dijkstra from 'source' (binary heap with decrease-key, O((V + E) log V)).
+// Fills *out; returns false if the source is missing or memory runs out.
+bool sp_dijkstra(Graph *g, const char *source, ShortestPathTree *out);
+
+// Same as sp_dijkstra, on a CSR snapshot (indices match the snapshot's).
+bool sp_dijkstra_csr(const GraphCSR *csr, const char *source, ShortestPathTree *out);
+
+// Dial's bucket-queue algorithm on a snapshot (weights 1..100); same tree as
+// sp_dijkstra_csr. Returns false if the source is missing or on OOM.
+bool sp_dial_csr(const GraphCSR *csr, const char *source, ShortestPathTree *out);
+
+// Delta-stepping on 'nthreads' threads (<= 0: one per CPU, fewer on small
+// graphs) with bucket width 'delta' (<= 0: SP_DELTA_DEFAULT); same tree as
+// sp_dijkstra_csr. Returns false if the source is missing or on OOM.
+bool sp_delta_stepping_csr(const GraphCSR *csr, const char *source, int delta,
+                           int nthreads, ShortestPathTree *out);
+
+// Bidirectional Dijkstra from 'source' to 'target'. Only the path's vertices
+// get dist/parent in *out; sp_print_path(out, target) prints the same path as
+// the single-source engines. Returns false if a vertex is missing or on OOM.
+bool sp_bidirectional_csr(const GraphCSR *csr, const char *source, const char *target,
+                          ShortestPathTree *out);
+
+// Pick k landmarks and store exact distances from each. NULL on OOM, an empty
+// graph, or a weight below 1 (use another engine then).
+SPLandmarks *sp_landmarks_build(const GraphCSR *csr, size_t k);
+void         sp_landmarks_destroy(SPLandmarks *lm);
+size_t       sp_landmarks_count(const SPLandmarks *lm);
+
+// A* between snapshot indices using the landmarks. Fills *out with the path
+// the single-source engines print (len 0: unreachable). Not reentrant per
+// SPLandmarks. Returns false on bad indices or OOM.
+bool sp_alt_query(SPLandmarks *lm, long source, long target, SPPath *out);
+
+// Command 9 through the landmarks ("0" on a missing vertex or no path).
+void sp_alt_print(SPLandmarks *lm, const char *startName, const char *endName);
+
+// Tree cache: create/destroy, and the tree rooted at 'source' (computed on a
+// miss, evicting the least recently used one). The returned tree is valid
+// until the next get. NULL if 'source' is missing or on OOM.
+SPTreeCache *sp_tree_cache_create(const GraphCSR *csr, size_t capacity);
+void         sp_tree_cache_destroy(SPTreeCache *cache);
+const ShortestPathTree *sp_tree_cache_get(SPTreeCache *cache, const char *source);
+
+// One source, many targets: a single run, then the command-9 line for each
+// target in order ("0" for a missing vertex or no path).
+void sp_batch_print(SPTreeCache *cache, const char *source,
+                    const char *const *targets, size_t count);
+void sp_batch_print_csr(const GraphCSR *csr, const char *source,
+                        const char *const *targets, size_t count);
+void shortestPathBatch(Graph *g, const char *source, const char *const *targets, size_t count);
+
+// All-pairs distances by blocked Floyd–Warshall (O(V^3) time, V^2 ints).
+// Returns false on OOM or an unsupported kernel.
+bool sp_apsp(Graph *g, SPDistanceMatrix *out);
+bool sp_apsp_csr(const GraphCSR *csr, SPDistanceMatrix *out);
+bool sp_apsp_csr_kernel(const GraphCSR *csr, SPApspKernel kernel, SPDistanceMatrix *out);
+bool sp_apsp_kernel_supported(SPApspKernel kernel);
+SPApspKernel sp_apsp_kernel_best(void);
+
+// Distance i -> j, SP_INF if unreachable or out of range.
+int  sp_apsp_get(const SPDistanceMatrix *m, size_t i, size_t j);
+
+// Tab-separated dump: header row of names, then "name<TAB>d0<TAB>d1...";
+// unreachable pairs print as INF.
+void sp_apsp_dump(const SPDistanceMatrix *m, FILE *f);
+void sp_apsp_free(SPDistanceMatrix *m);
+
+// Print a path in the command-9 format ("0" when empty); free its vertices.
+void sp_path_print(const GraphCSR *csr, const SPPath *p);
+void sp_path_free(SPPath *p);
+
+// Run the selected single-source engine on a snapshot (false for BIDIR/ALT/CH).
+bool sp_tree_csr(const GraphCSR *csr, const char *source, SPEngine engine,
+                 ShortestPathTree *out);
+
+// Map "heap" / "dial" / "bidir" / "alt" / "delta" / "ch" to an engine. Returns false for any other name.
+bool sp_engine_from_name(const char *name, SPEngine *out);
+
+// Release the arrays owned by a tree filled by sp_dijkstra. Safe on NULL.
+void sp_tree_free(ShortestPathTree *t);
+
+// Index of vertex 'name' in the tree, or -1 if it is not a vertex.
+int sp_tree_index_of(const ShortestPathTree *t, const char *name);
+
+// Print "A -> B -> C; Total edge cost = N" for the path to 'dst', or "0".
+void sp_print_path(const ShortestPathTree *t, int dst);
+
 void shortestPath(Graph* g, const char* startName, const char* endName);
+void shortestPath_csr(const GraphCSR* csr, const char* startName, const char* endName);
+
+// Command 9 with an explicit engine ("0" on a missing vertex or no path).
+void sp_print_csr(const GraphCSR *csr, const char *startName, const char *endName,
+                  SPEngine engine);
 
 #endif
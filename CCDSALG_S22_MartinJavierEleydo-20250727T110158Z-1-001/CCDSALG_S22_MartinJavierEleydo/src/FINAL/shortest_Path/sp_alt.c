@@ -0,0 +1,278 @@
+/*
+ * FILE: sp_alt.c
+ * --------------
+ * ALT (A*, Landmarks, Triangle inequality) point-to-point queries on a CSR
+ * snapshot, for workloads that ask many command-9 questions of one graph.
+ *
+ * Preprocessing (sp_landmarks_build):
+ *   - Picks k landmarks by farthest-point selection: the first is the vertex
+ *     farthest from vertex 0 (lexicographically first name); each next one
+ *     maximises its distance to the nearest landmark chosen so far, which
+ *     also gives every component its own landmark early. Ties go to the
+ *     smaller index, so the choice is deterministic.
+ *   - Stores exact distances from every landmark (one Dial run each) as
+ *     dist[v * k + i], so one vertex's bounds share a cache line.
+ *
+ * Query (sp_alt_query):
+ *   - A* keyed by g(v) + h(v), with h(v) = max_i |d(L_i, t) - d(L_i, v)|.
+ *     On an undirected graph this bound is consistent, so a settled vertex's
+ *     g is exact and the search stays inside an ellipse around s..t.
+ *   - If a landmark reaches exactly one of v and t, they are in different
+ *     components and v is skipped.
+ *   - After t is settled at cost D, every vertex with g + h <= D is settled
+ *     too (that covers every vertex on a shortest path), then the path is
+ *     rebuilt from t with the single-source engines' parent rule, as in
+ *     sp_bidirectional_csr.
+ *   - Per-query scratch lives in the landmark object and is reset through an
+ *     epoch stamp, so a query costs only what it touches. Queries on one
+ *     object must not run concurrently.
+ *
+ * The landmarks borrow the snapshot and go stale when the graph changes; main
+ * drops them together with its read snapshot (commands 1 and 2).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "graph.h"
+#include "heap.h"
+#include "shortest_Path.h"
+
+#define INF SP_INF
+
+struct SPLandmarks {
+    const GraphCSR *csr;
+    size_t          k;
+    uint32_t       *landmarks;  // Landmark vertex indices
+    int            *dist;       // dist[v * k + i] = d(landmarks[i], v), INF if unreachable
+
+    // --- Query scratch (valid where stamp[v] == epoch) ---
+    uint32_t       *stamp;
+    uint32_t        epoch;
+    int            *g;          // Tentative distance from the source
+    int            *h;          // Lower bound to the current target (INF: other component)
+    char           *done;
+    int            *target_dist; // d(L_i, target), k entries
+    IndexedHeap    *pq;
+};
+
+/*
+ * Function: sp_landmarks_build
+ * ----------------------------
+ * Preprocesses 'csr' with k landmarks (clamped to 1..n). Cost: k + 1
+ * single-source runs and k·n ints. Returns NULL on OOM, an empty graph, or a
+ * weight below 1 (A* bounds need positive weights; callers then use another
+ * engine, as with ch_build).
+ */
+SPLandmarks *sp_landmarks_build(const GraphCSR *csr, size_t k)
+{
+    if (!csr || csr->n == 0) return NULL;
+    for (size_t e = 0; e < csr->m; e++)
+        if (csr->weights[e] < 1) return NULL;
+    size_t n = csr->n;
+    if (k == 0) k = 1;
+    if (k > n) k = n;
+
+    SPLandmarks *lm = calloc(1, sizeof *lm);
+    if (!lm) return NULL;
+    lm->csr = csr;
+    lm->k = k;
+    lm->landmarks   = malloc(k * sizeof(uint32_t));
+    lm->dist        = malloc(n * k * sizeof(int));
+    lm->stamp       = calloc(n, sizeof(uint32_t));
+    lm->g           = malloc(n * sizeof(int));
+    lm->h           = malloc(n * sizeof(int));
+    lm->done        = malloc(n);
+    lm->target_dist = malloc(k * sizeof(int));
+    lm->pq          = iheap_create(n);
+    int *nearest    = malloc(n * sizeof(int));   // Distance to the closest landmark so far
+    if (!lm->landmarks || !lm->dist || !lm->stamp || !lm->g || !lm->h ||
+        !lm->done || !lm->target_dist || !lm->pq || !nearest)
+        goto fail;
+
+    // --- Seed: distances from vertex 0 decide the first landmark ---
+    ShortestPathTree t;
+    if (!sp_dial_csr(csr, csr->names[0], &t)) goto fail;
+    for (size_t v = 0; v < n; v++) nearest[v] = t.dist[v];
+    sp_tree_free(&t);
+
+    for (size_t i = 0; i < k; i++) {
+        // Farthest vertex from the chosen set; unreachable ones (INF) first
+        size_t pick = 0;
+        for (size_t v = 1; v < n; v++)
+            if (nearest[v] > nearest[pick]) pick = v;
+        lm->landmarks[i] = (uint32_t)pick;
+
+        if (!sp_dial_csr(csr, csr->names[pick], &t)) goto fail;
+        for (size_t v = 0; v < n; v++) {
+            lm->dist[v * k + i] = t.dist[v];
+            if (i == 0 || t.dist[v] < nearest[v]) nearest[v] = t.dist[v];
+        }
+        sp_tree_free(&t);
+    }
+
+    lm->epoch = 0;
+    free(nearest);
+    return lm;
+
+fail:
+    free(nearest);
+    sp_landmarks_destroy(lm);
+    return NULL;
+}
+
+void sp_landmarks_destroy(SPLandmarks *lm)
+{
+    if (!lm) return;
+    free(lm->landmarks);
+    free(lm->dist);
+    free(lm->stamp);
+    free(lm->g);
+    free(lm->h);
+    free(lm->done);
+    free(lm->target_dist);
+    iheap_destroy(lm->pq);
+    free(lm);
+}
+
+size_t sp_landmarks_count(const SPLandmarks *lm) { return lm ? lm->k : 0; }
+
+// Lower bound on d(v, target) from the landmark table (INF: unreachable).
+static int alt_bound(const SPLandmarks *lm, size_t v)
+{
+    const int *dv = &lm->dist[v * lm->k];
+    int best = 0;
+    for (size_t i = 0; i < lm->k; i++) {
+        int a = dv[i], b = lm->target_dist[i];
+        if ((a == INF) != (b == INF)) return INF;   // Different components
+        if (a == INF) continue;
+        int diff = a > b ? a - b : b - a;
+        if (diff > best) best = diff;
+    }
+    return best;
+}
+
+// First touch of v in this query: reset its scratch entries.
+static void alt_touch(SPLandmarks *lm, size_t v)
+{
+    if (lm->stamp[v] == lm->epoch) return;
+    lm->stamp[v] = lm->epoch;
+    lm->g[v] = INF;
+    lm->h[v] = alt_bound(lm, v);
+    lm->done[v] = 0;
+}
+
+// Distance label of v in this query (INF if untouched).
+static int alt_label(const SPLandmarks *lm, size_t v)
+{
+    return lm->stamp[v] == lm->epoch ? lm->g[v] : INF;
+}
+
+/*
+ * Function: sp_alt_query
+ * ----------------------
+ * A* from 'source' to 'target' (snapshot indices) with landmark bounds.
+ * Fills *out with the same path the single-source engines print (len 0 when
+ * there is none). Returns false on bad indices or OOM. Weights are known to
+ * be positive: sp_landmarks_build refuses snapshots with any other.
+ */
+bool sp_alt_query(SPLandmarks *lm, long source, long target, SPPath *out)
+{
+    if (!out) return false;
+    memset(out, 0, sizeof *out);
+    if (!lm || source < 0 || target < 0 ||
+        (size_t)source >= lm->csr->n || (size_t)target >= lm->csr->n)
+        return false;
+
+    const GraphCSR *csr = lm->csr;
+    size_t k = lm->k;
+    if (++lm->epoch == 0) {                     // Stamp wrap-around: start clean
+        memset(lm->stamp, 0, csr->n * sizeof(uint32_t));
+        lm->epoch = 1;
+    }
+    for (size_t i = 0; i < k; i++) lm->target_dist[i] = lm->dist[(size_t)target * k + i];
+    iheap_clear(lm->pq);
+
+    // --- Step 1: A* until every vertex with g + h <= D is settled ---
+    alt_touch(lm, (size_t)source);
+    if (lm->h[source] == INF) return true;      // Different components
+    lm->g[source] = 0;
+    iheap_push(lm->pq, (size_t)source, lm->h[source]);
+    long best = INF;
+    int f;
+    while (iheap_peek_min(lm->pq, &f) != SIZE_MAX && f <= best) {
+        size_t u = iheap_extract_min(lm->pq, NULL);
+        lm->done[u] = 1;
+        int gu = lm->g[u];
+        if (u == (size_t)target) best = gu;
+        for (size_t e = csr->offsets[u]; e < csr->offsets[u + 1]; e++) {
+            size_t v = csr->adj[e];
+            int w = csr->weights[e];
+            alt_touch(lm, v);
+            if (lm->done[v] || lm->h[v] == INF) continue;
+            int nd = gu + w;
+            if (nd < lm->g[v]) {
+                bool queued = lm->g[v] != INF;
+                lm->g[v] = nd;
+                if (queued) iheap_decrease_key(lm->pq, v, nd + lm->h[v]);
+                else        iheap_push(lm->pq, v, nd + lm->h[v]);
+            }
+        }
+    }
+    if (best == INF) return true;               // Not reached: no path
+
+    // --- Step 2: Walk the tight edges back from the target ---
+    size_t cap = 16, len = 0;
+    int *rev = malloc(cap * sizeof(int));
+    if (!rev) return false;
+    int v = (int)target, dv = (int)best;
+    rev[len++] = v;
+    while (v != (int)source) {
+        int pick = -1, pick_w = 0;
+        for (size_t e = csr->offsets[v]; e < csr->offsets[v + 1]; e++) {
+            int u = (int)csr->adj[e], w = csr->weights[e];
+            if (alt_label(lm, (size_t)u) != dv - w) continue;
+            if (w > pick_w || (w == pick_w && u > pick)) { pick = u; pick_w = w; }
+        }
+        if (pick < 0) { free(rev); return false; }   // Unreachable with exact labels
+        if (len == cap) {
+            int *grown = realloc(rev, 2 * cap * sizeof(int));
+            if (!grown) { free(rev); return false; }
+            rev = grown;
+            cap *= 2;
+        }
+        rev[len++] = pick;
+        v = pick;
+        dv -= pick_w;
+    }
+
+    // Source first
+    for (size_t i = 0; i < len / 2; i++) {
+        int tmp = rev[i];
+        rev[i] = rev[len - 1 - i];
+        rev[len - 1 - i] = tmp;
+    }
+    out->vertices = rev;
+    out->len = len;
+    out->cost = (int)best;
+    return true;
+}
+
+/*
+ * Function: sp_alt_print
+ * ----------------------
+ * Command 9 through the landmarks; output identical to shortestPath.
+ */
+void sp_alt_print(SPLandmarks *lm, const char *start, const char *end)
+{
+    SPPath p;
+    long s = (lm && start) ? graph_csr_index_of(lm->csr, start) : -1;
+    long t = (lm && end)   ? graph_csr_index_of(lm->csr, end)   : -1;
+    if (!sp_alt_query(lm, s, t, &p)) {
+        printf("0\n");
+        return;
+    }
+    sp_path_print(lm->csr, &p);
+    sp_path_free(&p);
+}
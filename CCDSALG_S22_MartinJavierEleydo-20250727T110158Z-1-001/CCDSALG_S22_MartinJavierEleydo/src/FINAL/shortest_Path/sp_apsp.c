@@ -0,0 +1,263 @@
+/*
+ * FILE: sp_apsp.c
+ * ---------------
+ * All-pairs shortest paths: a dense distance matrix filled by a cache-blocked
+ * Floyd–Warshall with SIMD min-plus kernels.
+ *
+ * Layout:
+ *   - Rows are padded to a multiple of SP_APSP_BLOCK (64) ints, and the
+ *     padded vertices are isolated (all INF), so every block is full size.
+ *   - While computing, "unreachable" is APSP_INF = INT_MAX / 2: the sum of two
+ *     entries never overflows, and min() keeps every entry <= APSP_INF.
+ *     The result reports unreachable pairs as SP_INF, like the other engines.
+ *
+ * Blocked Floyd–Warshall, for each diagonal block kb (B = 64):
+ *   1. the diagonal block (kb, kb) runs plain Floyd–Warshall on itself;
+ *   2. the blocks in row kb and column kb are updated from it;
+ *   3. every other block (i, j) gets min-plus with (i, kb) and (kb, j).
+ * Each step is the same kernel: C[i][j] = min(C[i][j], A[i][k] + B[k][j]),
+ * with k as the outer loop so steps 1 and 2 may alias C with A or B. A block
+ * triple is 48 KB, so the inner loops run out of L1/L2.
+ *
+ * Kernels: AVX2 (8 lanes) and SSE4.1 (4 lanes) versions are compiled with
+ * GCC/Clang target attributes and picked at run time from the CPU's feature
+ * bits; other compilers and CPUs use the scalar loop.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <limits.h>
+#include "graph.h"
+#include "shortest_Path.h"
+
+#define SP_APSP_BLOCK 64
+#define APSP_INF      (INT_MAX / 2)
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SP_APSP_X86 1
+#include <immintrin.h>
+#endif
+
+typedef void (*MinPlusKernel)(int *c, const int *a, const int *b, size_t stride);
+
+// --- Scalar kernel (reference) ---
+static void minplus_scalar(int *c, const int *a, const int *b, size_t stride)
+{
+    for (size_t k = 0; k < SP_APSP_BLOCK; k++) {
+        const int *bk = b + k * stride;
+        for (size_t i = 0; i < SP_APSP_BLOCK; i++) {
+            int aik = a[i * stride + k];
+            if (aik >= APSP_INF) continue;
+            int *ci = c + i * stride;
+            for (size_t j = 0; j < SP_APSP_BLOCK; j++) {
+                int via = aik + bk[j];
+                if (via < ci[j]) ci[j] = via;
+            }
+        }
+    }
+}
+
+#ifdef SP_APSP_X86
+// --- SSE4.1 kernel: 4 lanes of min(c, a + b) ---
+__attribute__((target("sse4.1")))
+static void minplus_sse41(int *c, const int *a, const int *b, size_t stride)
+{
+    for (size_t k = 0; k < SP_APSP_BLOCK; k++) {
+        const int *bk = b + k * stride;
+        for (size_t i = 0; i < SP_APSP_BLOCK; i++) {
+            int aik = a[i * stride + k];
+            if (aik >= APSP_INF) continue;
+            __m128i av = _mm_set1_epi32(aik);
+            int *ci = c + i * stride;
+            for (size_t j = 0; j < SP_APSP_BLOCK; j += 4) {
+                __m128i via = _mm_add_epi32(av, _mm_loadu_si128((const __m128i *)(bk + j)));
+                __m128i cur = _mm_loadu_si128((const __m128i *)(ci + j));
+                _mm_storeu_si128((__m128i *)(ci + j), _mm_min_epi32(cur, via));
+            }
+        }
+    }
+}
+
+// --- AVX2 kernel: 8 lanes of min(c, a + b) ---
+__attribute__((target("avx2")))
+static void minplus_avx2(int *c, const int *a, const int *b, size_t stride)
+{
+    for (size_t k = 0; k < SP_APSP_BLOCK; k++) {
+        const int *bk = b + k * stride;
+        for (size_t i = 0; i < SP_APSP_BLOCK; i++) {
+            int aik = a[i * stride + k];
+            if (aik >= APSP_INF) continue;
+            __m256i av = _mm256_set1_epi32(aik);
+            int *ci = c + i * stride;
+            for (size_t j = 0; j < SP_APSP_BLOCK; j += 8) {
+                __m256i via = _mm256_add_epi32(av, _mm256_loadu_si256((const __m256i *)(bk + j)));
+                __m256i cur = _mm256_loadu_si256((const __m256i *)(ci + j));
+                _mm256_storeu_si256((__m256i *)(ci + j), _mm256_min_epi32(cur, via));
+            }
+        }
+    }
+}
+#endif
+
+// Can this CPU run the kernel?
+bool sp_apsp_kernel_supported(SPApspKernel kernel)
+{
+    switch (kernel) {
+        case SP_APSP_AUTO:
+        case SP_APSP_SCALAR: return true;
+#ifdef SP_APSP_X86
+        case SP_APSP_SSE41:  return __builtin_cpu_supports("sse4.1");
+        case SP_APSP_AVX2:   return __builtin_cpu_supports("avx2");
+#else
+        case SP_APSP_SSE41:
+        case SP_APSP_AVX2:   return false;
+#endif
+    }
+    return false;
+}
+
+// Resolve AUTO to the widest supported kernel.
+SPApspKernel sp_apsp_kernel_best(void)
+{
+    if (sp_apsp_kernel_supported(SP_APSP_AVX2))  return SP_APSP_AVX2;
+    if (sp_apsp_kernel_supported(SP_APSP_SSE41)) return SP_APSP_SSE41;
+    return SP_APSP_SCALAR;
+}
+
+static MinPlusKernel kernel_fn(SPApspKernel kernel)
+{
+#ifdef SP_APSP_X86
+    if (kernel == SP_APSP_AVX2)  return minplus_avx2;
+    if (kernel == SP_APSP_SSE41) return minplus_sse41;
+#endif
+    (void)kernel;
+    return minplus_scalar;
+}
+
+/*
+ * Function: sp_apsp_csr_kernel
+ * ----------------------------
+ * Builds the matrix from a snapshot and runs blocked Floyd–Warshall with the
+ * chosen kernel. Returns false on OOM, an unsupported kernel, or a matrix
+ * that does not fit size_t.
+ */
+bool sp_apsp_csr_kernel(const GraphCSR *csr, SPApspKernel kernel, SPDistanceMatrix *out)
+{
+    if (!out) return false;
+    memset(out, 0, sizeof *out);
+    if (!csr || !sp_apsp_kernel_supported(kernel)) return false;
+    if (kernel == SP_APSP_AUTO) kernel = sp_apsp_kernel_best();
+    MinPlusKernel minplus = kernel_fn(kernel);
+
+    // --- Step 1: Padded matrix, INF except the diagonal and the edges ---
+    size_t n = csr->n;
+    size_t stride = (n + SP_APSP_BLOCK - 1) / SP_APSP_BLOCK * SP_APSP_BLOCK;
+    if (stride && stride > SIZE_MAX / sizeof(int) / stride) return false;
+    size_t cells = stride * stride;
+    int *d = malloc((cells ? cells : 1) * sizeof(int));
+    const char **names = malloc((n ? n : 1) * sizeof(const char *));
+    if (!d || !names) {
+        free(d);
+        free(names);
+        return false;
+    }
+    for (size_t i = 0; i < cells; i++) d[i] = APSP_INF;
+    for (size_t u = 0; u < n; u++) {
+        names[u] = csr->names[u];
+        d[u * stride + u] = 0;
+        for (size_t k = csr->offsets[u]; k < csr->offsets[u + 1]; k++) {
+            int w = csr->weights[k];
+            size_t v = csr->adj[k];
+            if (w >= 0 && w < d[u * stride + v]) d[u * stride + v] = w;
+        }
+    }
+
+    // --- Step 2: Blocked Floyd–Warshall ---
+    size_t blocks = stride / SP_APSP_BLOCK;
+    for (size_t kb = 0; kb < blocks; kb++) {
+        int *diag = d + kb * SP_APSP_BLOCK * stride + kb * SP_APSP_BLOCK;
+        minplus(diag, diag, diag, stride);                       // Phase 1
+        for (size_t j = 0; j < blocks; j++) {                    // Phase 2
+            if (j == kb) continue;
+            int *row = d + kb * SP_APSP_BLOCK * stride + j * SP_APSP_BLOCK;
+            int *col = d + j * SP_APSP_BLOCK * stride + kb * SP_APSP_BLOCK;
+            minplus(row, diag, row, stride);
+            minplus(col, col, diag, stride);
+        }
+        for (size_t i = 0; i < blocks; i++) {                    // Phase 3
+            if (i == kb) continue;
+            const int *ik = d + i * SP_APSP_BLOCK * stride + kb * SP_APSP_BLOCK;
+            for (size_t j = 0; j < blocks; j++) {
+                if (j == kb) continue;
+                const int *kj = d + kb * SP_APSP_BLOCK * stride + j * SP_APSP_BLOCK;
+                minplus(d + i * SP_APSP_BLOCK * stride + j * SP_APSP_BLOCK, ik, kj, stride);
+            }
+        }
+    }
+
+    // --- Step 3: Report unreachable pairs as SP_INF ---
+    for (size_t i = 0; i < cells; i++)
+        if (d[i] >= APSP_INF) d[i] = SP_INF;
+
+    out->n = n;
+    out->stride = stride;
+    out->names = names;
+    out->dist = d;
+    return true;
+}
+
+// Blocked Floyd–Warshall with the widest kernel this CPU supports.
+bool sp_apsp_csr(const GraphCSR *csr, SPDistanceMatrix *out)
+{
+    return sp_apsp_csr_kernel(csr, SP_APSP_AUTO, out);
+}
+
+// Graph entry point: freezes the graph, then runs sp_apsp_csr. The matrix's
+// names point into the graph, which must outlive it.
+bool sp_apsp(Graph *g, SPDistanceMatrix *out)
+{
+    GraphCSR *csr = graph_freeze(g);
+    bool ok = sp_apsp_csr(csr, out);
+    graph_csr_destroy(csr);
+    return ok;
+}
+
+// Distance i -> j (snapshot indices), SP_INF if unreachable or out of range.
+int sp_apsp_get(const SPDistanceMatrix *m, size_t i, size_t j)
+{
+    if (!m || i >= m->n || j >= m->n) return SP_INF;
+    return m->dist[i * m->stride + j];
+}
+
+/*
+ * Function: sp_apsp_dump
+ * ----------------------
+ * Tab-separated matrix: a header row of names, then one row per vertex
+ * (its name, then its distances). Unreachable pairs print as "INF".
+ */
+void sp_apsp_dump(const SPDistanceMatrix *m, FILE *f)
+{
+    if (!m || !f) return;
+    for (size_t j = 0; j < m->n; j++) fprintf(f, "\t%s", m->names[j]);
+    fputc('\n', f);
+    for (size_t i = 0; i < m->n; i++) {
+        fputs(m->names[i], f);
+        for (size_t j = 0; j < m->n; j++) {
+            int v = m->dist[i * m->stride + j];
+            if (v == SP_INF) fputs("\tINF", f);
+            else             fprintf(f, "\t%d", v);
+        }
+        fputc('\n', f);
+    }
+}
+
+// Release the arrays owned by a matrix. Safe on NULL.
+void sp_apsp_free(SPDistanceMatrix *m)
+{
+    if (!m) return;
+    free(m->names);
+    free(m->dist);
+    memset(m, 0, sizeof *m);
+}
@@ -0,0 +1,130 @@
+/*
+ * FILE: sp_batch.c
+ * ----------------
+ * One-to-many shortest path queries: one source, many targets, one
+ * single-source run, and one shortestPath-format line per target.
+ *
+ * Tree cache (SPTreeCache):
+ *   - Keeps the last few single-source trees of one CSR snapshot, keyed by
+ *     source index. A hit costs nothing; a miss runs Dial's algorithm (same
+ *     tree as the heap engine) and evicts the least recently used entry.
+ *   - Capacity is small (SP_TREE_CACHE_DEFAULT trees of 2·V ints each), so
+ *     lookup is a linear scan with a use counter.
+ *   - The cache borrows the snapshot; main drops it together with its read
+ *     snapshot (commands 1 and 2), so a mutation invalidates every tree.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "graph.h"
+#include "shortest_Path.h"
+
+typedef struct SPTreeCacheEntry {
+    ShortestPathTree tree;
+    uint64_t         last_use;   // 0: empty slot
+} SPTreeCacheEntry;
+
+struct SPTreeCache {
+    const GraphCSR   *csr;
+    size_t            capacity;
+    uint64_t          clock;
+    SPTreeCacheEntry *entries;
+};
+
+SPTreeCache *sp_tree_cache_create(const GraphCSR *csr, size_t capacity)
+{
+    if (!csr) return NULL;
+    if (capacity == 0) capacity = 1;
+    SPTreeCache *cache = malloc(sizeof *cache);
+    if (!cache) return NULL;
+    cache->entries = calloc(capacity, sizeof *cache->entries);
+    if (!cache->entries) {
+        free(cache);
+        return NULL;
+    }
+    cache->csr = csr;
+    cache->capacity = capacity;
+    cache->clock = 0;
+    return cache;
+}
+
+void sp_tree_cache_destroy(SPTreeCache *cache)
+{
+    if (!cache) return;
+    for (size_t i = 0; i < cache->capacity; i++)
+        if (cache->entries[i].last_use) sp_tree_free(&cache->entries[i].tree);
+    free(cache->entries);
+    free(cache);
+}
+
+/*
+ * Function: sp_tree_cache_get
+ * ---------------------------
+ * Tree rooted at 'source', from the cache or a fresh run. The pointer stays
+ * valid until the next sp_tree_cache_get or destroy. NULL if 'source' is not
+ * a vertex or on OOM.
+ */
+const ShortestPathTree *sp_tree_cache_get(SPTreeCache *cache, const char *source)
+{
+    if (!cache || !source) return NULL;
+    long s = graph_csr_index_of(cache->csr, source);
+    if (s < 0) return NULL;
+
+    // --- Hit: refresh its use stamp; otherwise remember the LRU slot ---
+    SPTreeCacheEntry *victim = &cache->entries[0];
+    for (size_t i = 0; i < cache->capacity; i++) {
+        SPTreeCacheEntry *e = &cache->entries[i];
+        if (e->last_use && e->tree.source == (int)s) {
+            e->last_use = ++cache->clock;
+            return &e->tree;
+        }
+        if (e->last_use < victim->last_use) victim = e;
+    }
+
+    // --- Miss: one single-source run replaces the LRU entry ---
+    ShortestPathTree t;
+    if (!sp_tree_csr(cache->csr, source, SP_ENGINE_DIAL, &t)) return NULL;
+    if (victim->last_use) sp_tree_free(&victim->tree);
+    victim->tree = t;
+    victim->last_use = ++cache->clock;
+    return &victim->tree;
+}
+
+// Print one line per target from a finished tree ("0" for unknown targets).
+static void print_targets(const ShortestPathTree *t, const char *const *targets, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+        sp_print_path(t, t ? sp_tree_index_of(t, targets[i]) : -1);
+}
+
+/*
+ * Function: sp_batch_print
+ * ------------------------
+ * Batch command through the cache: the line command 9 prints for each
+ * (source, targets[i]), in order, from a single tree.
+ */
+void sp_batch_print(SPTreeCache *cache, const char *source,
+                    const char *const *targets, size_t count)
+{
+    print_targets(sp_tree_cache_get(cache, source), targets, count);
+}
+
+// Same as sp_batch_print without a cache: one run, then the tree is dropped.
+void sp_batch_print_csr(const GraphCSR *csr, const char *source,
+                        const char *const *targets, size_t count)
+{
+    ShortestPathTree t;
+    bool ok = csr && source && sp_tree_csr(csr, source, SP_ENGINE_DIAL, &t);
+    print_targets(ok ? &t : NULL, targets, count);
+    if (ok) sp_tree_free(&t);
+}
+
+// Graph entry point: freezes the graph, then runs sp_batch_print_csr.
+void shortestPathBatch(Graph *g, const char *source, const char *const *targets, size_t count)
+{
+    GraphCSR *csr = graph_freeze(g);
+    sp_batch_print_csr(csr, source, targets, count);
+    graph_csr_destroy(csr);
+}
@@ -0,0 +1,307 @@
+/*
+ * FILE: sp_delta.c
+ * ----------------
+ * Parallel delta-stepping single-source shortest paths on a CSR snapshot
+ * (pthreads), producing the same ShortestPathTree as sp_dijkstra_csr.
+ *
+ * Buckets:
+ *   - A vertex with tentative distance d waits in bucket d / delta. Buckets
+ *     are drained in order; edges with w <= delta are "light" (they can land
+ *     back in the current bucket), heavier ones are "heavy" (they cannot).
+ *   - Draining bucket i repeats "take the bucket, relax its light edges"
+ *     until it stays empty, then relaxes the heavy edges of every vertex
+ *     removed from it once, with final distances.
+ *   - Only buckets i .. i + maxw/delta + 1 can be non-empty, so they live in
+ *     a ring of that many vectors. A vertex moved to a lower bucket leaves a
+ *     stale copy behind; queued_in[v] names the one live bucket.
+ *
+ * Parallelism:
+ *   - A worker pool (worker_pool.c) lives for one run. Each relaxation phase
+ *     splits the current vertex list into one slice per thread; threads
+ *     lower dist[] with an atomic compare-and-swap min and collect the
+ *     vertices they improved in private vectors, which the calling thread
+ *     merges into the buckets between phases. Small lists run on the
+ *     calling thread alone.
+ *   - Parents are chosen after the distances are final, in one more parallel
+ *     pass: the tight predecessor with the smallest distance (heaviest tight
+ *     edge), ties going to the greater index. That is the rule of the
+ *     sequential engines, so the tree does not depend on thread timing.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#include "graph.h"
+#include "worker_pool.h"
+#include "shortest_Path.h"
+
+#define INF SP_INF
+
+#define DELTA_MIN_WORK    (1u << 15)   // Adjacency entries per thread (default count)
+#define DELTA_MIN_SLICE   512          // Shorter vertex lists skip the pool
+
+typedef enum DeltaJob { DELTA_LIGHT, DELTA_HEAVY, DELTA_PARENTS } DeltaJob;
+
+// Vertices one thread improved during a phase. Padded to its own cache line.
+typedef struct DeltaOut {
+    uint32_t *items;
+    size_t    len, cap;
+    char      pad[64 - sizeof(uint32_t *) - 2 * sizeof(size_t)];
+} DeltaOut;
+
+typedef struct DeltaVec {
+    uint32_t *items;
+    size_t    len, cap;
+} DeltaVec;
+
+// State shared by all threads of one run.
+typedef struct DeltaRun {
+    const GraphCSR  *csr;
+    int              delta;
+    int              source;
+    _Atomic int     *dist;
+    int             *out_dist;     // Tree arrays, filled by DELTA_PARENTS
+    int             *out_parent;
+    const uint32_t  *work;         // Vertex list of the current phase
+    size_t           work_len;
+    DeltaOut        *outs;         // One per thread
+    int              nthreads;
+    WorkerPool      *pool;
+    atomic_bool      oom;
+} DeltaRun;
+
+static bool vec_push(uint32_t **items, size_t *len, size_t *cap, uint32_t v)
+{
+    if (*len == *cap) {
+        size_t ncap = *cap ? 2 * *cap : 256;
+        uint32_t *grown = realloc(*items, ncap * sizeof(uint32_t));
+        if (!grown) return false;
+        *items = grown;
+        *cap = ncap;
+    }
+    (*items)[(*len)++] = v;
+    return true;
+}
+
+// Relax the light (w <= delta) or heavy edges of work[lo, hi).
+static void relax_slice(DeltaRun *r, int t, size_t lo, size_t hi, bool light)
+{
+    const GraphCSR *csr = r->csr;
+    DeltaOut *out = &r->outs[t];
+    for (size_t i = lo; i < hi; i++) {
+        uint32_t u = r->work[i];
+        int du = atomic_load_explicit(&r->dist[u], memory_order_relaxed);
+        for (size_t k = csr->offsets[u]; k < csr->offsets[u + 1]; k++) {
+            int w = csr->weights[k];
+            if ((w <= r->delta) != light) continue;
+            uint32_t v = csr->adj[k];
+            int nd = du + w;
+            int cur = atomic_load_explicit(&r->dist[v], memory_order_relaxed);
+            bool lowered = false;
+            while (nd < cur) {
+                if (atomic_compare_exchange_weak_explicit(&r->dist[v], &cur, nd,
+                                                          memory_order_relaxed,
+                                                          memory_order_relaxed)) {
+                    lowered = true;
+                    break;
+                }
+            }
+            if (lowered && !vec_push(&out->items, &out->len, &out->cap, v))
+                atomic_store_explicit(&r->oom, true, memory_order_relaxed);
+        }
+    }
+}
+
+// Final distances and canonical parents for vertices [lo, hi).
+static void parents_slice(DeltaRun *r, size_t lo, size_t hi)
+{
+    const GraphCSR *csr = r->csr;
+    for (size_t v = lo; v < hi; v++) {
+        int dv = atomic_load_explicit(&r->dist[v], memory_order_relaxed);
+        int pick = -1, pick_w = 0;
+        if (dv != INF && (int)v != r->source) {
+            for (size_t k = csr->offsets[v]; k < csr->offsets[v + 1]; k++) {
+                int u = (int)csr->adj[k], w = csr->weights[k];
+                if (atomic_load_explicit(&r->dist[u], memory_order_relaxed) != dv - w) continue;
+                if (w > pick_w || (w == pick_w && u > pick)) { pick = u; pick_w = w; }
+            }
+        }
+        r->out_dist[v] = dv;
+        r->out_parent[v] = pick;
+    }
+}
+
+// Slice t of 'parts' of the current phase (WorkerSliceFn).
+static void run_slice(void *ctx, int job, int t, int parts)
+{
+    DeltaRun *r = ctx;
+    size_t len = (job == DELTA_PARENTS) ? r->csr->n : r->work_len;
+    size_t lo = len * (size_t)t / (size_t)parts;
+    size_t hi = len * (size_t)(t + 1) / (size_t)parts;
+    if (job == DELTA_PARENTS) parents_slice(r, lo, hi);
+    else                      relax_slice(r, t, lo, hi, job == DELTA_LIGHT);
+}
+
+// Run one phase on the pool; short vertex lists stay on the calling thread.
+static void run_phase(DeltaRun *r, DeltaJob job)
+{
+    size_t items = (job == DELTA_PARENTS) ? r->csr->n : r->work_len;
+    worker_pool_run(r->pool, job, items, DELTA_MIN_SLICE);
+}
+
+/*
+ * Helper: file_improved
+ * ---------------------
+ * After a phase, queue every vertex a thread improved under the bucket of its
+ * new distance (once per bucket), then clear the thread vectors. Returns
+ * false on OOM.
+ */
+static bool file_improved(DeltaRun *r, DeltaVec *ring, size_t nb, int *queued_in,
+                          size_t *queued)
+{
+    bool ok = !atomic_load(&r->oom);
+    for (int t = 0; t < r->nthreads; t++) {
+        DeltaOut *o = &r->outs[t];
+        for (size_t j = 0; ok && j < o->len; j++) {
+            uint32_t v = o->items[j];
+            int b = atomic_load_explicit(&r->dist[v], memory_order_relaxed) / r->delta;
+            if (queued_in[v] == b) continue;
+            queued_in[v] = b;
+            DeltaVec *dst = &ring[(size_t)b % nb];
+            ok = vec_push(&dst->items, &dst->len, &dst->cap, v);
+            (*queued)++;
+        }
+        o->len = 0;
+    }
+    return ok;
+}
+
+/*
+ * Function: sp_delta_stepping_csr
+ * -------------------------------
+ * Delta-stepping from 'source' with bucket width 'delta' (<= 0: default) on
+ * 'nthreads' threads (<= 0: one per CPU, fewer on small graphs). Fills *out
+ * with the tree sp_dijkstra_csr builds. Returns false if the source is
+ * missing or on OOM.
+ */
+bool sp_delta_stepping_csr(const GraphCSR *csr, const char *source, int delta,
+                           int nthreads, ShortestPathTree *out)
+{
+    if (!out) return false;
+    memset(out, 0, sizeof *out);
+    out->source = -1;
+    if (!csr || !source) return false;
+    long s = graph_csr_index_of(csr, source);
+    if (s < 0) return false;
+
+    // --- The largest weight (1..100, see GraphCSR) sizes the bucket ring ---
+    int maxw = 1;
+    for (size_t k = 0; k < csr->m; k++)
+        if (csr->weights[k] > maxw) maxw = csr->weights[k];
+    if (delta <= 0) delta = SP_DELTA_DEFAULT;
+    if (delta > maxw) delta = maxw;
+    size_t nb = (size_t)(maxw / delta) + 2;
+
+    // --- Thread count and allocation ---
+    nthreads = worker_pool_threads(nthreads, csr->m, DELTA_MIN_WORK);
+    size_t n = csr->n;
+    DeltaRun r;
+    memset(&r, 0, sizeof r);
+    r.csr = csr;
+    r.delta = delta;
+    r.source = (int)s;
+    r.nthreads = nthreads;
+    r.dist       = malloc(n * sizeof(_Atomic int));
+    r.outs       = calloc((size_t)nthreads, sizeof(DeltaOut));
+    out->names   = malloc(n * sizeof(const char *));
+    out->dist    = malloc(n * sizeof(int));
+    out->parent  = malloc(n * sizeof(int));
+    int *queued_in = malloc(n * sizeof(int));   // Live bucket of v, -1 if none
+    int *removed_in = malloc(n * sizeof(int));  // Last bucket v was drained from
+    DeltaVec *ring = calloc(nb, sizeof(DeltaVec));
+    DeltaVec frontier = { NULL, 0, 0 }, settled = { NULL, 0, 0 };
+    bool ok = r.dist && r.outs && out->names && out->dist && out->parent &&
+              queued_in && removed_in && ring;
+    if (ok) {
+        for (size_t v = 0; v < n; v++) {
+            atomic_init(&r.dist[v], INF);
+            out->names[v] = csr->names[v];
+            queued_in[v] = removed_in[v] = -1;
+        }
+        atomic_init(&r.dist[s], 0);
+        atomic_init(&r.oom, false);
+        r.out_dist = out->dist;
+        r.out_parent = out->parent;
+        ok = vec_push(&ring[0].items, &ring[0].len, &ring[0].cap, (uint32_t)s);
+        queued_in[s] = 0;
+    }
+
+    // --- Pool: workers 1..nthreads-1 wait for phases ---
+    r.pool = ok ? worker_pool_create(nthreads, run_slice, &r) : NULL;
+    ok = r.pool != NULL;
+
+    // --- Drain buckets in order ---
+    size_t queued = ok ? 1 : 0;        // Entries in the ring, stale ones included
+    for (int i = 0; ok && queued > 0; i++) {
+        DeltaVec *bucket = &ring[(size_t)i % nb];
+        settled.len = 0;
+        while (ok && bucket->len > 0) {
+            // Take the bucket, dropping stale copies
+            DeltaVec taken = *bucket;
+            *bucket = frontier;
+            bucket->len = 0;
+            queued -= taken.len;
+            frontier.len = 0;
+            for (size_t j = 0; j < taken.len; j++) {
+                uint32_t v = taken.items[j];
+                if (queued_in[v] != i) continue;
+                queued_in[v] = -1;
+                taken.items[frontier.len++] = v;
+                if (removed_in[v] != i) {
+                    removed_in[v] = i;
+                    ok = ok && vec_push(&settled.items, &settled.len, &settled.cap, v);
+                }
+            }
+            frontier = taken;
+            if (frontier.len == 0) break;
+
+            // Light edges, then file every improved vertex under its bucket
+            r.work = frontier.items;
+            r.work_len = frontier.len;
+            run_phase(&r, DELTA_LIGHT);
+            ok = ok && file_improved(&r, ring, nb, queued_in, &queued);
+        }
+        if (!ok || settled.len == 0) continue;
+
+        // Heavy edges of everything drained from bucket i, once
+        r.work = settled.items;
+        r.work_len = settled.len;
+        run_phase(&r, DELTA_HEAVY);
+        ok = file_improved(&r, ring, nb, queued_in, &queued);
+    }
+
+    // --- Parents from the final distances ---
+    if (ok) run_phase(&r, DELTA_PARENTS);
+    worker_pool_destroy(r.pool);
+
+    for (size_t b = 0; ring && b < nb; b++) free(ring[b].items);
+    for (int t = 0; r.outs && t < nthreads; t++) free(r.outs[t].items);
+    free(ring);
+    free(r.outs);
+    free(frontier.items);
+    free(settled.items);
+    free(queued_in);
+    free(removed_in);
+    free((void *)r.dist);
+    if (!ok) {
+        sp_tree_free(out);
+        return false;
+    }
+    out->n = n;
+    out->source = (int)s;
+    return true;
+}
@@ -0,0 +1,145 @@
+/* ============================================================================
+ *  worker_pool.c - Phase-synchronous thread pool implementation
+ *  ----------------------------------------------------------------------------
+ *  Workers sleep on 'go' until the generation counter moves past the last
+ *  one they saw, run their slice of the posted job, and the last one to
+ *  finish signals 'done'. Shutdown is one more generation with 'exiting' set.
+ * ==========================================================================*/
+
+#define _POSIX_C_SOURCE 200809L   // sysconf under -std=c11
+
+#include "worker_pool.h"
+#include <stdlib.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <unistd.h>
+
+typedef struct PoolWorker {
+    WorkerPool *pool;
+    int         t;
+} PoolWorker;
+
+struct WorkerPool {
+    WorkerSliceFn   fn;
+    void           *ctx;
+    int             nthreads;     // Slices per dispatched phase
+    int             started;      // Worker threads running (slices 1..started-1)
+    pthread_t       tid[WORKER_POOL_MAX_THREADS];
+    PoolWorker      workers[WORKER_POOL_MAX_THREADS];
+    pthread_mutex_t lock;
+    pthread_cond_t  go, done;
+    unsigned long   generation;   // Bumped once per dispatched phase
+    int             job;
+    int             pending;      // Workers still busy with this phase
+    bool            exiting;
+};
+
+/* -------------------------------------------------------------------------- */
+/*  THREAD COUNT                                                              */
+/* -------------------------------------------------------------------------- */
+int worker_pool_threads(int requested, size_t work, size_t min_work)
+{
+    int nthreads = requested;
+    if (nthreads <= 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        size_t by_work = work / (min_work ? min_work : 1) + 1;
+        nthreads = cpus > 0 ? (int)cpus : 1;
+        if ((size_t)nthreads > by_work) nthreads = (int)by_work;
+    }
+    if (nthreads > WORKER_POOL_MAX_THREADS) nthreads = WORKER_POOL_MAX_THREADS;
+    return nthreads;
+}
+
+/* -------------------------------------------------------------------------- */
+/*  WORKERS                                                                   */
+/* -------------------------------------------------------------------------- */
+static void *worker_main(void *p)
+{
+    PoolWorker *me = p;
+    WorkerPool *pool = me->pool;
+    unsigned long seen = 0;
+    for (;;) {
+        pthread_mutex_lock(&pool->lock);
+        while (pool->generation == seen) pthread_cond_wait(&pool->go, &pool->lock);
+        seen = pool->generation;
+        int job = pool->job;
+        bool exiting = pool->exiting;
+        pthread_mutex_unlock(&pool->lock);
+        if (exiting) return NULL;
+
+        pool->fn(pool->ctx, job, me->t, pool->nthreads);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->pending == 0) pthread_cond_signal(&pool->done);
+        pthread_mutex_unlock(&pool->lock);
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+/*  LIFECYCLE                                                                 */
+/* -------------------------------------------------------------------------- */
+WorkerPool *worker_pool_create(int nthreads, WorkerSliceFn fn, void *ctx)
+{
+    WorkerPool *pool = calloc(1, sizeof(WorkerPool));
+    if (!pool) return NULL;
+
+    if (nthreads < 1) nthreads = 1;
+    if (nthreads > WORKER_POOL_MAX_THREADS) nthreads = WORKER_POOL_MAX_THREADS;
+    pool->fn = fn;
+    pool->ctx = ctx;
+    pool->nthreads = nthreads;
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->go, NULL);
+    pthread_cond_init(&pool->done, NULL);
+
+    pool->started = 1;
+    for (int t = 1; t < nthreads; t++) {
+        pool->workers[t] = (PoolWorker){ pool, t };
+        if (pthread_create(&pool->tid[t], NULL, worker_main, &pool->workers[t]) != 0) break;
+        pool->started++;
+    }
+    return pool;
+}
+
+void worker_pool_destroy(WorkerPool *pool)
+{
+    if (!pool) return;
+    if (pool->started > 1) {
+        pthread_mutex_lock(&pool->lock);
+        pool->exiting = true;
+        pool->generation++;
+        pthread_cond_broadcast(&pool->go);
+        pthread_mutex_unlock(&pool->lock);
+        for (int t = 1; t < pool->started; t++) pthread_join(pool->tid[t], NULL);
+    }
+    pthread_cond_destroy(&pool->go);
+    pthread_cond_destroy(&pool->done);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool);
+}
+
+/* -------------------------------------------------------------------------- */
+/*  OPERATIONS                                                                */
+/* -------------------------------------------------------------------------- */
+void worker_pool_run(WorkerPool *pool, int job, size_t items, size_t min_items)
+{
+    if (pool->started <= 1 || items < min_items) {
+        pool->fn(pool->ctx, job, 0, 1);
+        return;
+    }
+    pthread_mutex_lock(&pool->lock);
+    pool->job = job;
+    pool->pending = pool->started - 1;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->go);
+    pthread_mutex_unlock(&pool->lock);
+
+    // Slice 0, and the slices of workers that could not start, run here
+    pool->fn(pool->ctx, job, 0, pool->nthreads);
+    for (int t = pool->started; t < pool->nthreads; t++)
+        pool->fn(pool->ctx, job, t, pool->nthreads);
+
+    pthread_mutex_lock(&pool->lock);
+    while (pool->pending > 0) pthread_cond_wait(&pool->done, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+}
@@ -0,0 +1,79 @@
+/* ============================================================================
+ *  worker_pool.h - Phase-synchronous thread pool for the parallel engines
+ *  ----------------------------------------------------------------------------
+ *  Shared by bfs_parallel_csr, sp_delta_stepping_csr and mst_boruvka_csr.
+ *  A pool lives for one run: its workers are started once and then wait for
+ *  phases. A phase is a job number handed to the owner's slice callback,
+ *  which is called once per slice t of 'parts' (slice 0 on the calling
+ *  thread) and returns when every slice is done.
+ *
+ *  Features:
+ *      - One pthread_create per worker per run, not per phase
+ *      - Short phases run on the calling thread alone
+ *      - Workers that fail to start have their slices run by the caller,
+ *        so a phase always covers all of its slices
+ * ==========================================================================*/
+
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define WORKER_POOL_MAX_THREADS 64
+
+/* -------------------------------------------------------------------------- */
+/*  TYPES                                                                     */
+/* -------------------------------------------------------------------------- */
+typedef struct WorkerPool WorkerPool;
+
+/**
+ * Run slice t of 'parts' of phase 'job' on the owner's state 'ctx'.
+ * 'parts' is the pool's thread count, or 1 for a phase run inline.
+ */
+typedef void (*WorkerSliceFn)(void *ctx, int job, int t, int parts);
+
+/* -------------------------------------------------------------------------- */
+/*  THREAD COUNT                                                              */
+/* -------------------------------------------------------------------------- */
+/**
+ * Thread count for a run over 'work' units (adjacency entries).
+ * @param requested Caller's count; <= 0 picks one per online CPU, lowered so
+ *                  each thread gets at least 'min_work' units
+ * @return 1 .. WORKER_POOL_MAX_THREADS
+ */
+int worker_pool_threads(int requested, size_t work, size_t min_work);
+
+/* -------------------------------------------------------------------------- */
+/*  LIFECYCLE                                                                 */
+/* -------------------------------------------------------------------------- */
+/**
+ * Start a pool of 'nthreads' slices (clamped to 1 .. WORKER_POOL_MAX_THREADS);
+ * slices 1 .. nthreads-1 get a worker thread each.
+ * @return New pool, or NULL on allocation failure
+ */
+WorkerPool *worker_pool_create(int nthreads, WorkerSliceFn fn, void *ctx);
+
+/**
+ * Stop and join the workers, then free the pool. NULL is a no-op.
+ */
+void worker_pool_destroy(WorkerPool *pool);
+
+/* -------------------------------------------------------------------------- */
+/*  OPERATIONS                                                                */
+/* -------------------------------------------------------------------------- */
+/**
+ * Run phase 'job' over all slices and wait for it. A phase over fewer than
+ * 'min_items' items (or a pool without running workers) is one slice on the
+ * calling thread: fn(ctx, job, 0, 1).
+ */
+void worker_pool_run(WorkerPool *pool, int job, size_t items, size_t min_items);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WORKER_POOL_H */
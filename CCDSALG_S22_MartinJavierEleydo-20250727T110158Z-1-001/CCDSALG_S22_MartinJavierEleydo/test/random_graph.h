@@ -0,0 +1,84 @@
+/* =======================================================================
+ *  random_graph.h  –  Random-graph fixture shared by the unit tests
+ *  -----------------------------------------------------------------------
+ *  Header-only; a test includes it after graph.h:
+ *
+ *      #include "random_graph.h"
+ *
+ *  make_random_graph(n, e, seed, weight_fn) adds vertices rg_names[0 .. n)
+ *  and then e random edge attempts. Attempt i draws u, then v, from an LCG
+ *  started at 'seed', and gets weight_fn(i, r), r being the generator state
+ *  after v (weight 1 for a NULL weight_fn). graph_add_edge drops self-loops
+ *  and a repeated pair keeps its last weight.
+ * =======================================================================
+ */
+#ifndef RANDOM_GRAPH_H
+#define RANDOM_GRAPH_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "graph.h"
+
+enum { RG_MAX_N = 4000 };
+
+/* rg_names[i]: name of vertex i of the last random graph (see random_names) */
+static char rg_names[RG_MAX_N][16];
+
+/* Weight of random edge i, from the generator state r after its endpoints */
+typedef int (*WeightFn)(int i, unsigned r);
+
+/* Advance the LCG and return its high bits */
+static inline unsigned rg_next(unsigned *seed)
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return *seed >> 8;
+}
+
+/* rg_names[i] = "v%04d" of (i * stride) % n. Stride 1 keeps index order equal
+ * to name order; a stride coprime with n scrambles it, so ids differ too. */
+static inline void random_names(int n, int stride)
+{
+    if (n > RG_MAX_N) {
+        fprintf(stderr, "random_names: n too large\n");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < n; ++i)
+        snprintf(rg_names[i], sizeof rg_names[i], "v%04d", (int)((long)i * stride % n));
+}
+
+/* e random edges into 'batch': u among rg_names[0 .. n_u), v among
+ * rg_names[0 .. n), same draws as make_random_graph */
+static inline void random_edges(GraphEdgeSpec *batch, int e, int n_u, int n,
+                                unsigned *seed, WeightFn weight_fn)
+{
+    for (int i = 0; i < e; ++i) {
+        batch[i].u = rg_names[rg_next(seed) % (unsigned)n_u];
+        batch[i].v = rg_names[rg_next(seed) % (unsigned)n];
+        batch[i].weight = weight_fn ? weight_fn(i, *seed) : 1;
+    }
+}
+
+/* n vertices named in index order, then e random edge attempts */
+static inline Graph *make_random_graph(int n, int e, unsigned seed, WeightFn weight_fn)
+{
+    Graph *g = graph_create();
+    random_names(n, 1);
+    for (int i = 0; i < n; ++i) graph_add_vertex(g, rg_names[i]);
+    for (int i = 0; i < e; ++i) {
+        int u = (int)(rg_next(&seed) % (unsigned)n);
+        int v = (int)(rg_next(&seed) % (unsigned)n);
+        graph_add_edge(g, rg_names[u], rg_names[v], weight_fn ? weight_fn(i, seed) : 1);
+    }
+    return g;
+}
+
+/* Uniform weights 1 .. k */
+static inline int weight_upto2(int i, unsigned r)   { (void)i; return (int)((r >> 4) % 2) + 1; }
+static inline int weight_upto3(int i, unsigned r)   { (void)i; return (int)((r >> 4) % 3) + 1; }
+static inline int weight_upto4(int i, unsigned r)   { (void)i; return (int)((r >> 4) % 4) + 1; }
+static inline int weight_upto5(int i, unsigned r)   { (void)i; return (int)((r >> 4) % 5) + 1; }
+static inline int weight_upto10(int i, unsigned r)  { (void)i; return (int)((r >> 4) % 10) + 1; }
+static inline int weight_upto100(int i, unsigned r) { (void)i; return (int)((r >> 4) % 100) + 1; }
+
+#endif /* RANDOM_GRAPH_H */
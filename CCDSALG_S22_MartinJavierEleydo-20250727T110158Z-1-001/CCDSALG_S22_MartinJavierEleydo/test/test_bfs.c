@@ -0,0 +1,207 @@
+/* =======================================================================
+ *  test_bfs.c  –  Unit tests for the BFS engines in bfs.[ch]
+ *  -----------------------------------------------------------------------
+ *  Compile (from project root):
+ *
+ *      gcc -Wall -Wextra -pedantic -std=c11 \
+ *          test/test_bfs.c \
+ *          src/graph/graph.c src/graph/graph_file.c \
+ *          src/bfs/bfs.c src/bfs/bfs_diropt.c src/bfs/bfs_parallel.c \
+ *          src/bfs/bfs_multi.c \
+ *          src/queue/queue.c src/worker_pool/worker_pool.c -pthread \
+ *          -o test_bfs
+ *
+ *  Run:
+ *      ./test_bfs
+ *
+ *  PASS ⇒ program exits 0 and prints a short summary.
+ * =======================================================================
+ */
+#define _POSIX_C_SOURCE 200809L   /* for dup/fileno on non-POSIX builds */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>     /* dup, fileno */
+
+#include "graph.h"
+#include "bfs.h"
+#include "random_graph.h"
+
+/* ---------- tiny assertion wrapper ---------- */
+static void fail(const char *msg)
+{
+    fprintf(stderr, "❌  %s\n", msg);
+    exit(EXIT_FAILURE);
+}
+#define REQUIRE(expr)  do { if(!(expr)) fail(#expr); } while(0)
+
+enum { MAX_N = 2000 };
+
+/* Plain FIFO BFS: the order bfs() prints */
+static size_t reference_order(const GraphCSR *csr, uint32_t s, uint32_t *order)
+{
+    char *seen = calloc(csr->n, 1);
+    if (!seen) fail("calloc failed");
+    size_t head = 0, tail = 0;
+    order[tail++] = s;
+    seen[s] = 1;
+    while (head < tail) {
+        uint32_t u = order[head++];
+        for (size_t k = csr->offsets[u]; k < csr->offsets[u + 1]; ++k) {
+            uint32_t v = csr->adj[k];
+            if (seen[v]) continue;
+            seen[v] = 1;
+            order[tail++] = v;
+        }
+    }
+    free(seen);
+    return tail;
+}
+
+/* Sparse (top-down), dense (bottom-up levels) and split graphs all agree */
+static void test_order_matches_fifo(void)
+{
+    const struct { int n, e; } shapes[] = {
+        { 500, 400 },       /* Forest-like, several components */
+        { 2000, 6000 },     /* Sparse */
+        { 2000, 40000 },    /* Dense: middle levels go bottom-up */
+        { 300, 20000 },     /* Almost complete */
+    };
+    static uint32_t want[MAX_N], got[MAX_N];
+    for (size_t t = 0; t < sizeof shapes / sizeof shapes[0]; ++t) {
+        Graph *g = make_random_graph(shapes[t].n, shapes[t].e, 100u + (unsigned)t, NULL);
+        GraphCSR *csr = graph_freeze(g);
+        for (int s = 0; s < shapes[t].n; s += 97) {
+            size_t count = 0;
+            size_t expect = reference_order(csr, (uint32_t)s, want);
+            REQUIRE( bfs_order_csr(csr, s, got, &count) );
+            REQUIRE( count == expect );
+            REQUIRE( memcmp(got, want, count * sizeof(uint32_t)) == 0 );
+        }
+        size_t count = 1;
+        REQUIRE( !bfs_order_csr(csr, shapes[t].n, got, &count) && count == 0 );
+        graph_csr_destroy(csr);
+        graph_destroy(g);
+    }
+}
+
+/* Command 5 output is byte-identical to the original bfs() */
+static void capture(void (*run)(Graph *, const GraphCSR *, const char *),
+                    Graph *g, const GraphCSR *csr, const char *start,
+                    char *buf, size_t buf_sz)
+{
+    fflush(stdout);
+    FILE *tmp = tmpfile();
+    if (!tmp) fail("tmpfile failed");
+    int saved_fd = dup(fileno(stdout));
+    dup2(fileno(tmp), fileno(stdout));
+    run(g, csr, start);
+    fflush(stdout);
+    dup2(saved_fd, fileno(stdout));
+    close(saved_fd);
+    rewind(tmp);
+    size_t len = fread(buf, 1, buf_sz - 1, tmp);
+    buf[len] = '\0';
+    fclose(tmp);
+}
+
+static void run_bfs(Graph *g, const GraphCSR *csr, const char *s)    { (void)csr; bfs(g, s); }
+static void run_diropt(Graph *g, const GraphCSR *csr, const char *s) { (void)g; bfs_diropt_csr(csr, s); }
+
+static void test_print_matches_bfs(void)
+{
+    static char want[MAX_N * 8 + 8], got[MAX_N * 8 + 8];
+    Graph *g = make_random_graph(600, 9000, 7, NULL);
+    GraphCSR *csr = graph_freeze(g);
+    capture(run_bfs, g, csr, "v0042", want, sizeof want);
+    capture(run_diropt, g, csr, "v0042", got, sizeof got);
+    REQUIRE( strcmp(got, want) == 0 );
+    capture(run_diropt, g, csr, "nope", got, sizeof got);
+    REQUIRE( got[0] == '\0' );
+    graph_csr_destroy(csr);
+    graph_destroy(g);
+}
+
+/* Parallel BFS: sorted levels match bfs(); unsorted ones hold the same vertices */
+static void test_parallel_matches_fifo(void)
+{
+    static uint32_t want[MAX_N], got[MAX_N];
+    static int level[MAX_N];
+    static char seen[MAX_N];
+    const int threads[] = { 1, 3, 8 };
+    Graph *g = make_random_graph(MAX_N, 30000, 4242, NULL);
+    GraphCSR *csr = graph_freeze(g);
+    for (int s = 0; s < MAX_N; s += 499) {
+        size_t expect = reference_order(csr, (uint32_t)s, want);
+        /* Level of every reached vertex, from the reference order */
+        for (int v = 0; v < MAX_N; ++v) level[v] = -1;
+        level[s] = 0;
+        for (size_t i = 0; i < expect; ++i)
+            for (size_t k = csr->offsets[want[i]]; k < csr->offsets[want[i] + 1]; ++k)
+                if (level[csr->adj[k]] < 0) level[csr->adj[k]] = level[want[i]] + 1;
+
+        for (size_t t = 0; t < sizeof threads / sizeof threads[0]; ++t) {
+            size_t count = 0;
+            REQUIRE( bfs_parallel_csr(csr, s, threads[t], true, got, &count) );
+            REQUIRE( count == expect );
+            REQUIRE( memcmp(got, want, count * sizeof(uint32_t)) == 0 );
+
+            REQUIRE( bfs_parallel_csr(csr, s, threads[t], false, got, &count) );
+            REQUIRE( count == expect );
+            memset(seen, 0, sizeof seen);
+            for (size_t i = 0; i < count; ++i) {
+                REQUIRE( level[got[i]] >= 0 && !seen[got[i]] );
+                REQUIRE( i == 0 || level[got[i]] >= level[got[i - 1]] );
+                seen[got[i]] = 1;
+            }
+        }
+    }
+    size_t count = 1;
+    REQUIRE( !bfs_parallel_csr(csr, -1, 2, true, got, &count) && count == 0 );
+    graph_csr_destroy(csr);
+    graph_destroy(g);
+}
+
+/* Multi-source BFS: every row equals a single-source level computation */
+static void test_multi_source_levels(void)
+{
+    enum { N = 700, K = 300 };          /* Two batches: 256 + 44 sources */
+    static uint32_t order[N], dist[K * N];
+    static long sources[K];
+    Graph *g = make_random_graph(N, 1200, 99, NULL);
+    GraphCSR *csr = graph_freeze(g);
+    for (int i = 0; i < K; ++i) sources[i] = (i * 37) % N;   /* Repeats included */
+    REQUIRE( bfs_multi_source_csr(csr, sources, K, dist) );
+
+    static uint32_t level[N];
+    for (int i = 0; i < K; ++i) {
+        for (int v = 0; v < N; ++v) level[v] = BFS_UNREACHED;
+        size_t count = reference_order(csr, (uint32_t)sources[i], order);
+        level[sources[i]] = 0;
+        for (size_t j = 0; j < count; ++j)
+            for (size_t k = csr->offsets[order[j]]; k < csr->offsets[order[j] + 1]; ++k)
+                if (level[csr->adj[k]] == BFS_UNREACHED)
+                    level[csr->adj[k]] = level[order[j]] + 1;
+        REQUIRE( memcmp(&dist[(size_t)i * N], level, sizeof level) == 0 );
+    }
+
+    long bad = N;
+    REQUIRE( !bfs_multi_source_csr(csr, &bad, 1, dist) );
+    REQUIRE( bfs_multi_source_csr(csr, NULL, 0, NULL) );
+    graph_csr_destroy(csr);
+    graph_destroy(g);
+}
+
+/* ---------- driver ---------- */
+int main(void)
+{
+    puts("Running BFS unit tests…");
+
+    test_order_matches_fifo();
+    test_print_matches_bfs();
+    test_parallel_matches_fifo();
+    test_multi_source_levels();
+
+    puts("✅  All BFS tests PASSED");
+    return EXIT_SUCCESS;
+}
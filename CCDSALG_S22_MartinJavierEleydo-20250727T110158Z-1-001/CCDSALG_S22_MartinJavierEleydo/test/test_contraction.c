@@ -0,0 +1,217 @@
+/* =======================================================================
+ *  test_contraction.c  –  Unit tests for the CH index in contraction.[ch]
+ *  -----------------------------------------------------------------------
+ *  Compile (from project root):
+ *
+ *      gcc -Wall -Wextra -pedantic -std=c11 \
+ *          test/test_contraction.c \
+ *          src/graph/graph.c src/graph/graph_file.c \
+ *          src/contraction/contraction.c \
+ *          src/shortest_Path/shortest_Path.c src/shortest_Path/sp_alt.c \
+ *          src/heap/heap.c \
+ *          -o test_contraction
+ *
+ *  Run:
+ *      ./test_contraction
+ *
+ *  PASS ⇒ program exits 0 and prints a short summary.
+ * =======================================================================
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "graph.h"
+#include "shortest_Path.h"
+#include "contraction.h"
+#include "random_graph.h"
+
+/* ---------- tiny assertion wrapper ---------- */
+static void fail(const char *msg)
+{
+    fprintf(stderr, "❌  %s\n", msg);
+    exit(EXIT_FAILURE);
+}
+#define REQUIRE(expr)  do { if(!(expr)) fail(#expr); } while(0)
+
+/* Random sparse graphs with few distinct weights (many equal-cost paths) */
+enum { N = 300, E = 800 };
+
+/* Every CH path equals the one the single-source engine prints */
+static void check_against_dijkstra(const GraphCSR *csr, CHIndex *ch)
+{
+    for (int src = 0; src < N; src += 17) {
+        ShortestPathTree h;
+        REQUIRE( sp_dijkstra_csr(csr, rg_names[src], &h) );
+        for (int dst = 0; dst < N; dst += 5) {
+            SPPath p;
+            REQUIRE( ch_query(ch, src, dst, &p) );
+            if (h.dist[dst] == SP_INF) { REQUIRE( p.len == 0 ); continue; }
+            REQUIRE( p.cost == h.dist[dst] && p.vertices[0] == src );
+            size_t i = p.len;
+            for (int v = dst; v != -1; v = h.parent[v])
+                REQUIRE( i > 0 && p.vertices[--i] == v );
+            REQUIRE( i == 0 );
+            sp_path_free(&p);
+        }
+        sp_tree_free(&h);
+    }
+}
+
+static void test_queries_match(void)
+{
+    const WeightFn weights[] = { weight_upto2, weight_upto5, weight_upto100 };
+    for (size_t t = 0; t < sizeof weights / sizeof weights[0]; ++t) {
+        Graph *g = make_random_graph(N, E, 500u + (unsigned)t, weights[t]);
+        GraphCSR *csr = graph_freeze(g);
+        CHIndex *ch = ch_build(csr);
+        REQUIRE( ch && ch_edge_count(ch) >= csr->m / 2 );
+        check_against_dijkstra(csr, ch);
+
+        SPPath p;
+        REQUIRE(!ch_query(ch, 0, N, &p) );
+        ch_destroy(ch);
+        graph_csr_destroy(csr);
+        graph_destroy(g);
+    }
+}
+
+/* A hub joined to every vertex: high-degree walks with many tied parents */
+static void test_hub_ties(void)
+{
+    Graph *g = make_random_graph(N, E, 31, weight_upto2);
+    for (int v = 1; v < N; ++v) graph_add_edge(g, rg_names[0], rg_names[v], 1 + v % 3);
+    GraphCSR *csr = graph_freeze(g);
+    CHIndex *ch = ch_build(csr);
+    REQUIRE( ch );
+    check_against_dijkstra(csr, ch);
+    ch_destroy(ch);
+    graph_csr_destroy(csr);
+    graph_destroy(g);
+}
+
+/* Saved index reloads for the same snapshot and is rejected for another */
+static void test_index_file(void)
+{
+    const char *path = "test_contraction.chx";
+    Graph *g = make_random_graph(N, E, 77, weight_upto10);
+    GraphCSR *csr = graph_freeze(g);
+    CHIndex *ch = ch_build(csr);
+    REQUIRE( ch && ch_save(ch, path) );
+
+    CHIndex *loaded = ch_load(path, csr);
+    REQUIRE( loaded && ch_edge_count(loaded) == ch_edge_count(ch) );
+    check_against_dijkstra(csr, loaded);
+    ch_destroy(loaded);
+
+    /* One weight change makes the file stale */
+    graph_add_edge(g, rg_names[0], rg_names[1], 42);
+    GraphCSR *changed = graph_freeze(g);
+    REQUIRE( ch_load(path, changed) == NULL );
+    REQUIRE( ch_load("no_such_file.chx", csr) == NULL );
+
+    remove(path);
+    graph_csr_destroy(changed);
+    ch_destroy(ch);
+    graph_csr_destroy(csr);
+    graph_destroy(g);
+}
+
+/* Whole file into a malloc'd buffer */
+static unsigned char *read_file(const char *path, size_t *len)
+{
+    FILE *f = fopen(path, "rb");
+    REQUIRE( f && fseek(f, 0, SEEK_END) == 0 );
+    long size = ftell(f);
+    REQUIRE( size > 0 && fseek(f, 0, SEEK_SET) == 0 );
+    unsigned char *buf = malloc((size_t)size);
+    REQUIRE( buf && fread(buf, 1, (size_t)size, f) == (size_t)size );
+    fclose(f);
+    *len = (size_t)size;
+    return buf;
+}
+
+static void write_file(const char *path, const unsigned char *buf, size_t len)
+{
+    FILE *f = fopen(path, "wb");
+    REQUIRE( f && fwrite(buf, 1, len, f) == len );
+    fclose(f);
+}
+
+/* Version-1 files and corrupted shortcut middles are rejected on load.
+ * File layout (contraction.c): 48-byte header (version at byte 8), rank[n],
+ * up_off[n + 1] as uint64, then up_adj, up_w and up_mid, m_up entries each. */
+static void test_index_file_rejected(void)
+{
+    const char *path = "test_contraction.chx";
+    Graph *g = make_random_graph(N, E, 78, weight_upto10);
+    GraphCSR *csr = graph_freeze(g);
+    CHIndex *ch = ch_build(csr);
+    REQUIRE( ch && ch_save(ch, path) );
+
+    size_t len, m_up = ch_edge_count(ch);
+    unsigned char *file = read_file(path, &len);
+    const uint32_t *rank = (const uint32_t *)(file + 48);
+    uint32_t *mid = (uint32_t *)(file + len - m_up * sizeof(uint32_t));
+
+    /* Version 1: same header, no up_mid section */
+    uint32_t version = 1;
+    memcpy(file + 8, &version, sizeof version);
+    write_file(path, file, len - m_up * sizeof(uint32_t));
+    REQUIRE( ch_load(path, csr) == NULL );
+    version = 2;
+    memcpy(file + 8, &version, sizeof version);
+    write_file(path, file, len);
+    CHIndex *loaded = ch_load(path, csr);               /* the valid baseline */
+    REQUIRE( loaded );
+    ch_destroy(loaded);
+
+    /* A shortcut's middle must rank below both ends of its edge */
+    uint32_t top = 0;
+    while (rank[top] != csr->n - 1) ++top;             /* highest-ranked vertex */
+    size_t k = 0;
+    while (k < m_up && mid[k] == UINT32_MAX) ++k;       /* first shortcut */
+    REQUIRE( k < m_up );
+    uint32_t saved = mid[k];
+    mid[k] = top;
+    write_file(path, file, len);
+    REQUIRE( ch_load(path, csr) == NULL );
+    mid[k] = (uint32_t)csr->n;                          /* out of range */
+    write_file(path, file, len);
+    REQUIRE( ch_load(path, csr) == NULL );
+    mid[k] = saved;
+
+    remove(path);
+    free(file);
+    ch_destroy(ch);
+    graph_csr_destroy(csr);
+    graph_destroy(g);
+}
+
+/* "ch" names the engine; it has no single-source tree */
+static void test_engine_name(void)
+{
+    SPEngine e;
+    REQUIRE( sp_engine_from_name("ch", &e) && e == SP_ENGINE_CH );
+    Graph *g = make_random_graph(N, E, 79, weight_upto10);
+    GraphCSR *csr = graph_freeze(g);
+    ShortestPathTree t;
+    REQUIRE(!sp_tree_csr(csr, rg_names[0], SP_ENGINE_CH, &t) );
+    graph_csr_destroy(csr);
+    graph_destroy(g);
+}
+
+/* ---------- driver ---------- */
+int main(void)
+{
+    puts("Running contraction hierarchy unit tests…");
+
+    test_queries_match();
+    test_hub_ties();
+    test_index_file();
+    test_index_file_rejected();
+    test_engine_name();
+
+    puts("✅  All contraction hierarchy tests PASSED");
+    return EXIT_SUCCESS;
+}
@@ -13,6 +13,8 @@
 #include <stddef.h>
 
 #include "graph.h"    /* public API – still opaque */
+#include "graph_internal.h" /* index/span traversal view */
+#include "random_graph.h"
 
 #define REQUIRE(cond)                                                        \
     do {                                                                     \
@@ -77,6 +79,311 @@ static void test_edge_logic(void)
     graph_destroy(g);
 }
 
+static void test_many_vertices(void)
+{
+    enum { N = 5000 };
+    Graph *g = graph_create();
+    char name[16];
+
+    /* insert in a scrambled order (7919 is coprime with N) */
+    for (int i = 0; i < N; ++i) {
+        snprintf(name, sizeof name, "v%04d", (i * 7919) % N);
+        REQUIRE( graph_add_vertex(g, name) );
+    }
+    REQUIRE( GP(g)->v_count == N );
+    REQUIRE(!graph_add_vertex(g, "v1234") );     /* duplicate via index */
+    REQUIRE( graph_vertex_exists(g, "v0000") );
+    REQUIRE( graph_vertex_exists(g, "v4999") );
+    REQUIRE(!graph_vertex_exists(g, "v5000") );
+
+    REQUIRE( graph_add_edge(g, "v0001", "v4998", 9) );
+    REQUIRE( graph_get_edge_weight(g, "v4998", "v0001") == 9 );
+
+    /* list order is still lexicographic */
+    const char **names = malloc(N * sizeof *names);
+    REQUIRE(names);
+    REQUIRE( graph_get_vertex_names(g, names) == N );
+    for (int i = 1; i < N; ++i)
+        REQUIRE( strcmp(names[i - 1], names[i]) < 0 );
+
+    free(names);
+    graph_destroy(g);
+}
+
+static void test_csr_snapshot(void)
+{
+    Graph *g = graph_create();
+    graph_add_vertex(g, "C");
+    graph_add_vertex(g, "A");
+    graph_add_vertex(g, "B");
+    graph_add_vertex(g, "D");
+    graph_add_edge(g, "C", "A", 4);
+    graph_add_edge(g, "A", "B", 7);
+    graph_add_edge(g, "B", "C", 2);
+
+    GraphCSR *csr = graph_freeze(g);
+    REQUIRE( csr );
+    REQUIRE( csr->n == 4 && csr->m == 6 );
+    REQUIRE( strcmp(csr->names[0], "A") == 0 && strcmp(csr->names[3], "D") == 0 );
+    REQUIRE( graph_csr_index_of(csr, "C") == 2 );
+    REQUIRE( graph_csr_index_of(csr, "Z") == -1 );
+
+    /* A: {B:7, C:4}   B: {A:7, C:2}   C: {A:4, B:2}   D: {} */
+    REQUIRE( csr->offsets[0] == 0 && csr->offsets[1] == 2 );
+    REQUIRE( csr->adj[0] == 1 && csr->weights[0] == 7 );
+    REQUIRE( csr->adj[1] == 2 && csr->weights[1] == 4 );
+    REQUIRE( csr->adj[4] == 0 && csr->adj[5] == 1 && csr->weights[5] == 2 );
+    REQUIRE( csr->offsets[3] == 6 && csr->offsets[4] == 6 );
+
+    graph_csr_destroy(csr);
+    graph_destroy(g);
+}
+
+static void test_vertex_ids(void)
+{
+    Graph *g = graph_create();
+    graph_add_vertex(g, "C");
+    graph_add_vertex(g, "A");
+    graph_add_vertex(g, "B");
+
+    /* ids follow insertion order; names resolve both ways */
+    VertexId c = graph_vertex_id(g, "C");
+    VertexId a = graph_vertex_id(g, "A");
+    VertexId b = graph_vertex_id(g, "B");
+    REQUIRE( c == 0 && a == 1 && b == 2 );
+    REQUIRE( graph_vertex_id(g, "Z") == GRAPH_NO_VERTEX );
+    REQUIRE( strcmp(graph_vertex_name(g, a), "A") == 0 );
+
+    REQUIRE( graph_add_edge_id(g, c, a, 4) );
+    REQUIRE( graph_add_edge_id(g, a, b, 7) );
+    REQUIRE( !graph_add_edge_id(g, a, a, 3) );               /* self-loop */
+    REQUIRE( !graph_add_edge_id(g, a, GRAPH_NO_VERTEX, 3) );
+    REQUIRE( graph_edge_exists_id(g, b, a) );
+    REQUIRE( graph_get_degree_id(g, a) == 2 );
+    REQUIRE( graph_get_edge_weight_id(g, a, c) == 4 );
+
+    /* neighbor ids come back in name order: A -> {B, C} */
+    VertexId nbr[3];
+    int w[3];
+    REQUIRE( graph_get_neighbor_ids(g, a, nbr, w) == 2 );
+    REQUIRE( nbr[0] == b && w[0] == 7 && nbr[1] == c && w[1] == 4 );
+
+    /* zero-copy iterator yields the same (id, weight) pairs */
+    GraphNeighborIter it;
+    const GraphNeighbor *nb;
+    REQUIRE( graph_neighbors_begin(g, a, &it) );
+    REQUIRE( (nb = graph_neighbors_next(&it)) && nb->id == b && nb->weight == 7 );
+    REQUIRE( (nb = graph_neighbors_next(&it)) && nb->id == c && nb->weight == 4 );
+    REQUIRE( graph_neighbors_next(&it) == NULL );
+    REQUIRE( graph_neighbors_next(&it) == NULL );
+    REQUIRE( !graph_neighbors_begin(g, GRAPH_NO_VERTEX, &it) );
+    REQUIRE( graph_neighbors_next(&it) == NULL );
+
+    /* traversal view: dense index bound and in-place adjacency spans */
+    REQUIRE( graph_index_bound(g) == 3 );
+    GraphAdjSpan span = graph_adj_span(g, a);
+    REQUIRE( span.deg == 2 );
+    REQUIRE( span.adj[0].id == b && span.adj[0].weight == 7 );
+    REQUIRE( span.adj[1].id == c && span.adj[1].weight == 4 );
+    span = graph_adj_span(g, GRAPH_NO_VERTEX);
+    REQUIRE( span.adj == NULL && span.deg == 0 );
+
+    VertexId order[3];
+    REQUIRE( graph_get_vertex_ids(g, order) == 3 );
+    REQUIRE( order[0] == a && order[1] == b && order[2] == c );
+
+    graph_destroy(g);
+}
+
+/* Bulk load vs. one-at-a-time inserts: same vertices, edges and weights */
+static void test_bulk_load(void)
+{
+    enum { N = 300, E = 4000 };
+    Graph *ref = graph_create();
+    Graph *bulk = graph_create();
+    random_names(N, 7);
+
+    /* a few edges exist before bulk mode starts */
+    for (Graph **gp = (Graph *[]){ ref, bulk, NULL }; *gp; ++gp) {
+        graph_add_vertex(*gp, rg_names[0]);
+        graph_add_vertex(*gp, rg_names[1]);
+        graph_add_vertex(*gp, rg_names[2]);
+        graph_add_edge(*gp, rg_names[0], rg_names[1], 50);
+        graph_add_edge(*gp, rg_names[1], rg_names[2], 60);
+    }
+
+    GraphEdgeSpec *batch = malloc(E * sizeof *batch);
+    REQUIRE(batch);
+    unsigned seed = 12345;
+    random_edges(batch, E, 40, N, &seed, weight_upto100);  /* dense: many duplicates */
+    batch[7].weight = 0;                                   /* skipped: bad weight */
+    batch[8].v = batch[8].u;                               /* skipped: self-loop */
+    /* overrides a pre-bulk edge */
+    batch[9] = (GraphEdgeSpec){ rg_names[1], rg_names[0], 7 };
+
+    size_t valid = 0;
+    for (int i = 0; i < E; ++i) {
+        if (batch[i].weight < 1 || batch[i].u == batch[i].v) continue;
+        graph_add_vertex(ref, batch[i].u);
+        graph_add_vertex(ref, batch[i].v);
+        REQUIRE( graph_add_edge(ref, batch[i].u, batch[i].v, batch[i].weight) );
+        valid++;
+    }
+
+    REQUIRE( graph_bulk_begin(bulk) );
+    REQUIRE(!graph_bulk_begin(bulk) );
+    size_t accepted = graph_bulk_add_edges(bulk, batch, E / 2);
+    accepted += graph_bulk_add_edges(bulk, batch + E / 2, E - E / 2);
+    REQUIRE( accepted == valid );
+    REQUIRE( graph_bulk_commit(bulk) );
+    REQUIRE( graph_get_edge_weight(bulk, rg_names[0], rg_names[1]) ==
+             graph_get_edge_weight(ref, rg_names[0], rg_names[1]) );
+
+    REQUIRE( graph_vertex_count(bulk) == graph_vertex_count(ref) );
+    /* edge counts: m of the two snapshots */
+    GraphCSR *a = graph_freeze(ref);
+    GraphCSR *b = graph_freeze(bulk);
+    REQUIRE( a && b && a->n == b->n && a->m == b->m );
+    for (size_t i = 0; i < a->n; ++i) {
+        REQUIRE( strcmp(a->names[i], b->names[i]) == 0 );
+        REQUIRE( a->offsets[i + 1] == b->offsets[i + 1] );
+    }
+    for (size_t k = 0; k < a->m; ++k)
+        REQUIRE( a->adj[k] == b->adj[k] && a->weights[k] == b->weights[k] );
+
+    graph_csr_destroy(a);
+    graph_csr_destroy(b);
+    free(batch);
+    graph_destroy(ref);
+    graph_destroy(bulk);
+}
+
+/* graph_save + graph_open_mmap round-trip to the same CSR as graph_freeze */
+static void test_file_roundtrip(void)
+{
+    const char *path = "test_graph_roundtrip.bin";
+    Graph *g = graph_create();
+    graph_add_vertex(g, "delta");
+    graph_add_vertex(g, "alpha");
+    graph_add_vertex(g, "charlie");
+    graph_add_vertex(g, "bravo");
+    graph_add_vertex(g, "echo");              /* isolated vertex */
+    graph_add_edge(g, "alpha", "charlie", 4);
+    graph_add_edge(g, "delta", "bravo", 100);
+    graph_add_edge(g, "alpha", "bravo", 1);
+
+    REQUIRE( graph_save(g, path) );
+    GraphCSR *a = graph_freeze(g);
+    GraphCSR *b = graph_open_mmap(path);
+    REQUIRE( a && b && b->mapping );
+    REQUIRE( a->n == b->n && a->m == b->m );
+    for (size_t i = 0; i < a->n; ++i) {
+        REQUIRE( strcmp(a->names[i], b->names[i]) == 0 );
+        REQUIRE( a->offsets[i + 1] == b->offsets[i + 1] );
+    }
+    for (size_t k = 0; k < a->m; ++k)
+        REQUIRE( a->adj[k] == b->adj[k] && a->weights[k] == b->weights[k] );
+    REQUIRE( graph_csr_index_of(b, "echo") == 4 );
+
+    /* the mapped snapshot outlives the graph it came from */
+    graph_csr_destroy(a);
+    graph_destroy(g);
+    REQUIRE( strcmp(b->names[0], "alpha") == 0 );
+    graph_csr_destroy(b);
+
+    /* a corrupted or truncated file is rejected */
+    FILE *f = fopen(path, "r+b");
+    REQUIRE(f);
+    fputc('X', f);                            /* clobber the magic */
+    fclose(f);
+    REQUIRE(!graph_open_mmap(path) );
+    f = fopen(path, "wb");
+    REQUIRE(f);
+    fputs("MCO2GRF", f);
+    fclose(f);
+    REQUIRE(!graph_open_mmap(path) );
+    REQUIRE(!graph_open_mmap("no_such_file.bin") );
+
+    /* well-formed header, bad adjacency: every variant is rejected on open */
+    const char *nm[3] = { "a", "b", "c" };
+    size_t off[4] = { 0, 1, 2, 2 };
+    uint32_t adj[2] = { 1, 0 };
+    int w[2] = { 5, 5 };
+    GraphCSR bad = { .n = 3, .m = 2, .offsets = off, .adj = adj, .weights = w, .names = nm };
+    REQUIRE( graph_csr_save(&bad, path) );
+    REQUIRE( (b = graph_open_mmap(path)) != NULL );   /* the valid baseline */
+    graph_csr_destroy(b);
+    adj[0] = 7;                                      /* neighbor out of range */
+    REQUIRE( graph_csr_save(&bad, path) && !graph_open_mmap(path) );
+    adj[0] = 1; w[1] = 6;                            /* weights disagree */
+    REQUIRE( graph_csr_save(&bad, path) && !graph_open_mmap(path) );
+    w[1] = 5; w[0] = w[1] = 0;                       /* weight below 1 */
+    REQUIRE( graph_csr_save(&bad, path) && !graph_open_mmap(path) );
+    w[0] = w[1] = 5; adj[1] = 2;                     /* one-directional rows */
+    REQUIRE( graph_csr_save(&bad, path) && !graph_open_mmap(path) );
+    remove(path);
+}
+
+/* Component label of every CSR vertex by flood fill (reference for graph_connected) */
+static void csr_components(const GraphCSR *c, size_t *comp)
+{
+    size_t *stack = malloc((c->n ? c->n : 1) * sizeof *stack);
+    REQUIRE(stack);
+    for (size_t i = 0; i < c->n; ++i) comp[i] = (size_t)-1;
+    for (size_t s = 0; s < c->n; ++s) {
+        if (comp[s] != (size_t)-1) continue;
+        size_t top = 0;
+        comp[s] = s;
+        stack[top++] = s;
+        while (top) {
+            size_t u = stack[--top];
+            for (size_t k = c->offsets[u]; k < c->offsets[u + 1]; ++k)
+                if (comp[c->adj[k]] == (size_t)-1) {
+                    comp[c->adj[k]] = s;
+                    stack[top++] = c->adj[k];
+                }
+        }
+    }
+    free(stack);
+}
+
+/* graph_connected agrees with a search, for incremental and bulk inserts */
+static void test_connectivity(void)
+{
+    enum { N = 400, E = 300 };
+    Graph *g = graph_create();
+    random_names(N, 13);
+    for (int i = 0; i < N; ++i) graph_add_vertex(g, rg_names[i]);
+    REQUIRE( graph_connected(g, "v0001", "v0001") );
+    REQUIRE(!graph_connected(g, "v0001", "v0002") );
+    REQUIRE(!graph_connected(g, "v0001", "nope") );
+
+    GraphEdgeSpec batch[E];
+    unsigned seed = 777;
+    for (int round = 0; round < 2; ++round) {
+        if (round == 1) REQUIRE( graph_bulk_begin(g) );
+        random_edges(batch, E, N, N, &seed, NULL);
+        if (round == 0) {
+            for (int i = 0; i < E; ++i) graph_add_edge(g, batch[i].u, batch[i].v, 1);
+        } else {
+            graph_bulk_add_edges(g, batch, E);
+            REQUIRE( graph_bulk_commit(g) );
+        }
+
+        GraphCSR *c = graph_freeze(g);
+        size_t *comp = malloc(N * sizeof *comp);
+        REQUIRE( c && comp );
+        csr_components(c, comp);
+        for (size_t a = 0; a < c->n; a += 7)
+            for (size_t b = 0; b < c->n; ++b)
+                REQUIRE( graph_connected(g, c->names[a], c->names[b]) ==
+                         (comp[a] == comp[b]) );
+        free(comp);
+        graph_csr_destroy(c);
+    }
+    graph_destroy(g);
+}
+
 static void test_print_example(void)
 {
     Graph *g = graph_create();
@@ -97,6 +404,12 @@ int main(void)
 {
     test_vertex_insertion();
     test_edge_logic();
+    test_many_vertices();
+    test_csr_snapshot();
+    test_vertex_ids();
+    test_bulk_load();
+    test_file_roundtrip();
+    test_connectivity();
     test_print_example();
 
     puts("All graph tests passed ✔");
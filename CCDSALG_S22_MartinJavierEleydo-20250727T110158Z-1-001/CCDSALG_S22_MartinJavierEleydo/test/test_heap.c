@@ -68,6 +68,37 @@ static void test_decrease_key_stability(void)
     heap_destroy(h);
 }
 
+static void test_indexed_decrease_key(void)
+{
+    const size_t N = 500;
+    IndexedHeap *h = iheap_create(N);
+    REQUIRE(h);
+
+    for (size_t i = 0; i < N; ++i)
+        REQUIRE(iheap_push(h, i, (int)(i + 1000)));
+    REQUIRE(!iheap_push(h, 7, 1));           /* already queued */
+
+    /* lower every third id after the heap has been shuffled by sifts */
+    for (size_t i = 0; i < N; i += 3)
+        REQUIRE(iheap_decrease_key(h, i, (int)(N - i)));
+    REQUIRE(!iheap_decrease_key(h, 0, 5000)); /* not a decrease */
+
+    int prev = -1;
+    size_t count = 0;
+    while (!iheap_is_empty(h)) {
+        int key;
+        size_t id = iheap_extract_min(h, &key);
+        REQUIRE(id < N && !iheap_contains(h, id));
+        REQUIRE(key == ((id % 3 == 0) ? (int)(N - id) : (int)(id + 1000)));
+        REQUIRE(key >= prev);
+        prev = key;
+        ++count;
+    }
+    REQUIRE(count == N);
+    REQUIRE(iheap_extract_min(h, NULL) == SIZE_MAX);
+    iheap_destroy(h);
+}
+
 static void test_random_sequence(void)
 {
     const int N = 50000;
@@ -110,6 +141,7 @@ int main(void)
 {
     printf("Running heap unit tests…\n");
 
+    test_indexed_decrease_key();
     test_basic_push_extract();
     test_decrease_key_stability();
     test_random_sequence();
@@ -0,0 +1,148 @@
+/* =======================================================================
+ *  test_mst.c  –  Unit tests for the MST engines in mst.[ch]
+ *  -----------------------------------------------------------------------
+ *  Compile (from project root):
+ *
+ *      gcc -Wall -Wextra -pedantic -std=c11 -pthread \
+ *          test/test_mst.c \
+ *          src/graph/graph.c src/graph/graph_file.c \
+ *          src/mst/mst.c src/mst/mst_boruvka.c \
+ *          src/heap/heap.c src/worker_pool/worker_pool.c \
+ *          -o test_mst
+ *
+ *  Run:
+ *      ./test_mst
+ *
+ *  PASS ⇒ program exits 0 and prints a short summary.
+ * =======================================================================
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "graph.h"
+#include "mst.h"
+#include "random_graph.h"
+
+/* ---------- tiny assertion wrapper ---------- */
+static void fail(const char *msg)
+{
+    fprintf(stderr, "❌  %s\n", msg);
+    exit(EXIT_FAILURE);
+}
+#define REQUIRE(expr)  do { if(!(expr)) fail(#expr); } while(0)
+
+/* Edges must be u < v, strictly sorted by (u, v) */
+static void check_sorted(const MSTResult *r)
+{
+    for (size_t i = 0; i < r->edge_count; ++i) {
+        REQUIRE( r->edges[i].u < r->edges[i].v );
+        if (i > 0)
+            REQUIRE( r->edges[i - 1].u < r->edges[i].u ||
+                     (r->edges[i - 1].u == r->edges[i].u &&
+                      r->edges[i - 1].v < r->edges[i].v) );
+    }
+}
+
+/* Square A-B-C-D with a heavy diagonal; E is isolated */
+static void test_small_forest(void)
+{
+    Graph *g = graph_create();
+    const char *names[] = { "A", "B", "C", "D", "E" };
+    for (int i = 0; i < 5; ++i) graph_add_vertex(g, names[i]);
+    graph_add_edge(g, "A", "B", 1);
+    graph_add_edge(g, "B", "C", 2);
+    graph_add_edge(g, "C", "D", 3);
+    graph_add_edge(g, "D", "A", 4);
+    graph_add_edge(g, "A", "C", 9);
+
+    GraphCSR *csr = graph_freeze(g);
+    MSTResult r;
+    REQUIRE( mst_compute(csr, MST_KRUSKAL, &r) );
+    REQUIRE( r.n == 5 && r.edge_count == 3 && r.total_weight == 6 );
+    /* (A,B,1) (B,C,2) (C,D,3) by index */
+    REQUIRE( r.edges[0].u == 0 && r.edges[0].v == 1 && r.edges[0].weight == 1 );
+    REQUIRE( r.edges[1].u == 1 && r.edges[1].v == 2 && r.edges[1].weight == 2 );
+    REQUIRE( r.edges[2].u == 2 && r.edges[2].v == 3 && r.edges[2].weight == 3 );
+    REQUIRE( strcmp(r.names[4], "E") == 0 );
+    mst_result_free(&r);
+
+    MSTAlgorithm algo;
+    REQUIRE( mst_algorithm_from_name("kruskal", &algo) && algo == MST_KRUSKAL );
+    REQUIRE( mst_algorithm_from_name("prim", &algo) && algo == MST_PRIM );
+    REQUIRE( mst_algorithm_from_name("boruvka", &algo) && algo == MST_BORUVKA );
+    REQUIRE(!mst_algorithm_from_name("boruvka?", &algo) );
+
+    /* Hand-built one-directional rows (0 -> 1, 0 -> 2, no mirrors): more
+       u < v entries than m / 2, which must not overrun Kruskal's edge list */
+    const char *nm[3] = { "A", "B", "C" };
+    size_t off[4] = { 0, 2, 2, 2 };
+    uint32_t adj[2] = { 1, 2 };
+    int w[2] = { 3, 1 };
+    GraphCSR oneway = { .n = 3, .m = 2, .offsets = off, .adj = adj, .weights = w, .names = nm };
+    REQUIRE( mst_kruskal_csr(&oneway, &r) );
+    REQUIRE( r.edge_count == 2 && r.total_weight == 4 );
+    mst_result_free(&r);
+
+    graph_csr_destroy(csr);
+    graph_destroy(g);
+}
+
+/* Kruskal and Prim agree on total weight and forest size on random graphs */
+static void test_engines_agree(void)
+{
+    enum { N = 300, E = 900 };
+    Graph *g = make_random_graph(N, E, 4242, weight_upto100);
+
+    GraphCSR *csr = graph_freeze(g);
+    MSTResult p, k;
+    REQUIRE( mst_compute(csr, MST_PRIM, &p) );
+    REQUIRE( mst_compute(csr, MST_KRUSKAL, &k) );
+    REQUIRE( p.total_weight == k.total_weight );
+    REQUIRE( p.edge_count == k.edge_count );
+    check_sorted(&p);
+    check_sorted(&k);
+    mst_result_free(&p);
+    mst_result_free(&k);
+
+    graph_csr_destroy(csr);
+    graph_destroy(g);
+}
+
+/* Borůvka returns Kruskal's exact forest, whatever the thread count */
+static void test_boruvka_matches_kruskal(void)
+{
+    enum { N = 2000, E = 8000 };
+    /* Few distinct weights: lots of ties to break */
+    Graph *g = make_random_graph(N, E, 777, weight_upto5);
+
+    GraphCSR *csr = graph_freeze(g);
+    MSTResult k;
+    REQUIRE( mst_compute(csr, MST_KRUSKAL, &k) );
+    const int threads[] = { 1, 3, 8 };
+    for (size_t t = 0; t < sizeof threads / sizeof threads[0]; ++t) {
+        MSTResult b;
+        REQUIRE( mst_boruvka_csr(csr, threads[t], &b) );
+        REQUIRE( b.edge_count == k.edge_count && b.total_weight == k.total_weight );
+        check_sorted(&b);
+        REQUIRE( memcmp(b.edges, k.edges, k.edge_count * sizeof(MSTEdge)) == 0 );
+        mst_result_free(&b);
+    }
+    mst_result_free(&k);
+
+    graph_csr_destroy(csr);
+    graph_destroy(g);
+}
+
+/* ---------- driver ---------- */
+int main(void)
+{
+    puts("Running MST unit tests…");
+
+    test_small_forest();
+    test_engines_agree();
+    test_boruvka_matches_kruskal();
+
+    puts("✅  All MST tests PASSED");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,408 @@
+/* =======================================================================
+ *  test_shortest_path.c  –  Unit & regression tests for shortest_Path.[ch]
+ *  -----------------------------------------------------------------------
+ *  Compile (from project root):
+ *
+ *      gcc -Wall -Wextra -pedantic -std=c11 \
+ *          test/test_shortest_path.c \
+ *          src/graph/graph.c \
+ *          src/algorithms/shortest_Path/shortest_Path.c \
+ *          src/data_structures/heap/heap.c \
+ *          -o test_shortest_path
+ *
+ *  Run:
+ *      ./test_shortest_path
+ *
+ *  PASS ⇒ program exits 0 and prints a short summary.
+ * =======================================================================
+ */
+#define _POSIX_C_SOURCE 200809L   /* for dup/fileno on non-POSIX builds */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>     /* dup, fileno */
+
+#include "graph.h"
+#include "shortest_Path.h"
+#include "random_graph.h"
+
+/* ---------- tiny assertion wrapper ---------- */
+static void fail(const char *msg)
+{
+    fprintf(stderr, "❌  %s\n", msg);
+    exit(EXIT_FAILURE);
+}
+#define REQUIRE(expr)  do { if(!(expr)) fail(#expr); } while(0)
+
+/* ---------- capture helper ---------- */
+static char *capture_shortest_path(Graph *g,
+                                   const char *src,
+                                   const char *dst,
+                                   char *buf,
+                                   size_t buf_sz)
+{
+    fflush(stdout);
+    FILE *tmp = tmpfile();
+    if(!tmp) fail("tmpfile failed");
+
+    int saved_fd = dup(fileno(stdout));
+    dup2(fileno(tmp), fileno(stdout));
+
+    shortestPath(g, src, dst);
+
+    fflush(stdout);
+    fseek(tmp, 0, SEEK_SET);
+    if (!fgets(buf, (int)buf_sz, tmp)) buf[0] = '\0';
+
+    dup2(saved_fd, fileno(stdout));
+    close(saved_fd);
+    fclose(tmp);
+    return buf;
+}
+
+/* ---------- graph builder ---------- */
+static Graph *make_graph(void)
+/* Graph:  A-1-B-1-D ,  A-1-C-1-D ,  A-5-D ,  E (isolated)
+ * Two equal-cost A→D routes; the tie goes to the later name (C). */
+{
+    Graph *g = graph_create();
+    graph_add_vertex(g, "D"); graph_add_vertex(g, "B");
+    graph_add_vertex(g, "A"); graph_add_vertex(g, "C");
+    graph_add_vertex(g, "E");
+
+    graph_add_edge(g, "A", "B", 1);
+    graph_add_edge(g, "B", "D", 1);
+    graph_add_edge(g, "A", "C", 1);
+    graph_add_edge(g, "C", "D", 1);
+    graph_add_edge(g, "A", "D", 5);
+    return g;
+}
+
+/* ---------- tests ---------- */
+static void test_tree_distances(void)
+{
+    Graph *g = make_graph();
+    ShortestPathTree t;
+    REQUIRE(sp_dijkstra(g, "A", &t));
+    REQUIRE(t.n == 5);
+
+    int a = sp_tree_index_of(&t, "A"), c = sp_tree_index_of(&t, "C");
+    int d = sp_tree_index_of(&t, "D"), e = sp_tree_index_of(&t, "E");
+    REQUIRE(t.source == a);
+    REQUIRE(t.dist[a] == 0 && t.parent[a] == -1);
+    REQUIRE(t.dist[d] == 2 && t.parent[d] == c);
+    REQUIRE(t.dist[e] == SP_INF && t.parent[e] == -1);
+    REQUIRE(sp_tree_index_of(&t, "Z") == -1);
+
+    sp_tree_free(&t);
+    REQUIRE(!sp_dijkstra(g, "Z", &t));
+    graph_destroy(g);
+}
+
+static void test_print_format(void)
+{
+    Graph *g = make_graph();
+    char out[128];
+
+    capture_shortest_path(g, "A", "D", out, sizeof out);
+    REQUIRE(strcmp(out, "A -> C -> D; Total edge cost = 2\n") == 0);
+
+    capture_shortest_path(g, "A", "A", out, sizeof out);
+    REQUIRE(strcmp(out, "A; Total edge cost = 0\n") == 0);
+
+    capture_shortest_path(g, "A", "E", out, sizeof out);
+    REQUIRE(strcmp(out, "0\n") == 0);
+
+    capture_shortest_path(g, "A", "Z", out, sizeof out);
+    REQUIRE(strcmp(out, "0\n") == 0);
+
+    graph_destroy(g);
+}
+
+/* sp_dijkstra on the live graph builds the snapshot engine's exact tree */
+static void test_graph_engine_matches_csr(void)
+{
+    enum { N = 300, E = 900 };
+    Graph *g = make_random_graph(N, E, 4711, weight_upto4);
+    GraphCSR *csr = graph_freeze(g);
+    for (int src = 0; src < N; src += 29) {
+        ShortestPathTree a, b;
+        REQUIRE(sp_dijkstra(g, rg_names[src], &a));
+        REQUIRE(sp_dijkstra_csr(csr, rg_names[src], &b));
+        REQUIRE(a.n == b.n && a.source == b.source && a.source == src);
+        REQUIRE(memcmp(a.names, b.names, a.n * sizeof(const char *)) == 0);
+        REQUIRE(memcmp(a.dist, b.dist, a.n * sizeof(int)) == 0);
+        REQUIRE(memcmp(a.parent, b.parent, a.n * sizeof(int)) == 0);
+        sp_tree_free(&a);
+        sp_tree_free(&b);
+    }
+    graph_csr_destroy(csr);
+    graph_destroy(g);
+}
+
+/* Small weight range: many equal-cost paths; 100 exercises wrap-around */
+static int weight_dial(int i, unsigned r)
+{
+    return (i % 50 == 0) ? 100 : weight_upto4(i, r);
+}
+
+/* Dial's buckets build the heap engine's exact tree (dist and parents) */
+static void test_dial_matches_heap(void)
+{
+    enum { N = 400, E = 1600 };
+    Graph *g = make_random_graph(N, E, 99, weight_dial);
+
+    GraphCSR *csr = graph_freeze(g);
+    for (int src = 0; src < N; src += 37) {
+        ShortestPathTree h, d;
+        REQUIRE(sp_tree_csr(csr, rg_names[src], SP_ENGINE_HEAP, &h));
+        REQUIRE(sp_tree_csr(csr, rg_names[src], SP_ENGINE_DIAL, &d));
+        REQUIRE(h.n == d.n && h.source == d.source);
+        REQUIRE(memcmp(h.dist, d.dist, h.n * sizeof(int)) == 0);
+        REQUIRE(memcmp(h.parent, d.parent, h.n * sizeof(int)) == 0);
+        sp_tree_free(&h);
+        sp_tree_free(&d);
+    }
+
+    SPEngine e;
+    REQUIRE(sp_engine_from_name("dial", &e) && e == SP_ENGINE_DIAL);
+    REQUIRE(sp_engine_from_name("heap", &e) && e == SP_ENGINE_HEAP);
+    REQUIRE(!sp_engine_from_name("radix", &e));
+
+    graph_csr_destroy(csr);
+    graph_destroy(g);
+}
+
+/* Bidirectional search prints the single-source engine's path for every pair */
+static void test_bidirectional_matches_heap(void)
+{
+    enum { N = 300, E = 700 };
+    /* Sparse, few weights: several components and many equal-cost paths */
+    Graph *g = make_random_graph(N, E, 2024, weight_upto3);
+
+    GraphCSR *csr = graph_freeze(g);
+    for (int src = 0; src < N; src += 23) {
+        ShortestPathTree h;
+        REQUIRE(sp_dijkstra_csr(csr, rg_names[src], &h));
+        for (int dst = 0; dst < N; dst += 7) {
+            ShortestPathTree b;
+            REQUIRE(sp_bidirectional_csr(csr, rg_names[src], rg_names[dst], &b));
+            REQUIRE(b.dist[dst] == h.dist[dst]);
+            if (h.dist[dst] == SP_INF) { sp_tree_free(&b); continue; }
+            for (int v = dst; v != -1; v = h.parent[v])
+                REQUIRE(b.parent[v] == h.parent[v] && b.dist[v] == h.dist[v]);
+            sp_tree_free(&b);
+        }
+        sp_tree_free(&h);
+    }
+
+    ShortestPathTree b;
+    REQUIRE(!sp_bidirectional_csr(csr, "v0000", "zzz", &b));
+    REQUIRE(!sp_tree_csr(csr, "v0000", SP_ENGINE_BIDIR, &b));
+    SPEngine e;
+    REQUIRE(sp_engine_from_name("bidir", &e) && e == SP_ENGINE_BIDIR);
+
+    graph_csr_destroy(csr);
+    graph_destroy(g);
+}
+
+/* ALT queries return the single-source engine's path for every pair */
+static void test_alt_matches_heap(void)
+{
+    enum { N = 250, E = 600 };
+    Graph *g = make_random_graph(N, E, 31337, weight_upto4);
+
+    GraphCSR *csr = graph_freeze(g);
+    SPLandmarks *lm = sp_landmarks_build(csr, 4);
+    REQUIRE(lm && sp_landmarks_count(lm) == 4);
+    for (int src = 0; src < N; src += 19) {
+        ShortestPathTree h;
+        REQUIRE(sp_dijkstra_csr(csr, rg_names[src], &h));
+        for (int dst = 0; dst < N; dst += 3) {
+            SPPath p;
+            REQUIRE(sp_alt_query(lm, src, dst, &p));
+            if (h.dist[dst] == SP_INF) { REQUIRE(p.len == 0); continue; }
+            REQUIRE(p.cost == h.dist[dst] && p.vertices[0] == src);
+            /* Walk the heap tree back from dst alongside the ALT path */
+            size_t i = p.len;
+            for (int v = dst; v != -1; v = h.parent[v])
+                REQUIRE(i > 0 && p.vertices[--i] == v);
+            REQUIRE(i == 0);
+            sp_path_free(&p);
+        }
+        sp_tree_free(&h);
+    }
+
+    SPPath p;
+    REQUIRE(!sp_alt_query(lm, 0, N, &p));
+    sp_landmarks_destroy(lm);
+
+    /* A weight below 1 (hand-made snapshot): no landmarks, caller falls back */
+    int saved = csr->weights[0];
+    csr->weights[0] = 0;
+    REQUIRE(sp_landmarks_build(csr, 4) == NULL);
+    csr->weights[0] = saved;
+
+    graph_csr_destroy(csr);
+    graph_destroy(g);
+}
+
+/* Every Floyd–Warshall kernel fills in the heap engine's distances */
+static void test_apsp_matches_heap(void)
+{
+    enum { N = 150, E = 400 };   /* Not a multiple of the block: exercises padding */
+    Graph *g = make_random_graph(N, E, 4242, weight_upto100);
+
+    GraphCSR *csr = graph_freeze(g);
+    const SPApspKernel kernels[] = { SP_APSP_SCALAR, SP_APSP_SSE41, SP_APSP_AVX2, SP_APSP_AUTO };
+    for (size_t k = 0; k < sizeof kernels / sizeof kernels[0]; ++k) {
+        SPDistanceMatrix m;
+        if (!sp_apsp_kernel_supported(kernels[k])) {
+            REQUIRE(!sp_apsp_csr_kernel(csr, kernels[k], &m));
+            continue;
+        }
+        REQUIRE(sp_apsp_csr_kernel(csr, kernels[k], &m));
+        REQUIRE(m.n == N && m.stride >= N);
+        for (int src = 0; src < N; ++src) {
+            ShortestPathTree h;
+            REQUIRE(sp_dijkstra_csr(csr, rg_names[src], &h));
+            for (int dst = 0; dst < N; ++dst)
+                REQUIRE(sp_apsp_get(&m, (size_t)src, (size_t)dst) == h.dist[dst]);
+            sp_tree_free(&h);
+        }
+        REQUIRE(sp_apsp_get(&m, 0, N) == SP_INF);
+        sp_apsp_free(&m);
+    }
+    graph_csr_destroy(csr);
+    graph_destroy(g);
+
+    /* Dump: header of names, INF for unreachable pairs */
+    Graph *small = graph_create();
+    graph_add_vertex(small, "A");
+    graph_add_vertex(small, "B");
+    graph_add_vertex(small, "C");
+    graph_add_edge(small, "A", "B", 5);
+    SPDistanceMatrix m;
+    REQUIRE(sp_apsp(small, &m));
+    FILE *tmp = tmpfile();
+    if (!tmp) fail("tmpfile failed");
+    sp_apsp_dump(&m, tmp);
+    char buf[128];
+    size_t len = (rewind(tmp), fread(buf, 1, sizeof buf - 1, tmp));
+    buf[len] = '\0';
+    REQUIRE(strcmp(buf, "\tA\tB\tC\nA\t0\t5\tINF\nB\t5\t0\tINF\nC\tINF\tINF\t0\n") == 0);
+    fclose(tmp);
+    sp_apsp_free(&m);
+    graph_destroy(small);
+}
+
+/* One batch run prints command 9's line for every target; the LRU reuses trees */
+static void test_batch_matches_single(void)
+{
+    Graph *g = make_graph();
+    const char *targets[] = { "D", "A", "Z", "E", "C" };
+    const size_t count = sizeof targets / sizeof targets[0];
+    GraphCSR *csr = graph_freeze(g);
+    SPTreeCache *cache = sp_tree_cache_create(csr, 2);
+    REQUIRE(cache);
+
+    /* Capture the batch output, then compare line by line with command 9 */
+    fflush(stdout);
+    FILE *tmp = tmpfile();
+    if (!tmp) fail("tmpfile failed");
+    int saved_fd = dup(fileno(stdout));
+    dup2(fileno(tmp), fileno(stdout));
+    sp_batch_print(cache, "A", targets, count);
+    sp_batch_print(cache, "Z", targets, 1);          /* Missing source */
+    shortestPathBatch(g, "B", targets, count);
+    fflush(stdout);
+    dup2(saved_fd, fileno(stdout));
+    close(saved_fd);
+
+    rewind(tmp);
+    char got[128], want[128];
+    for (size_t i = 0; i < 2 * count + 1; ++i) {
+        REQUIRE(fgets(got, sizeof got, tmp));
+        if (i == count) { REQUIRE(strcmp(got, "0\n") == 0); continue; }
+        const char *src = i < count ? "A" : "B";
+        capture_shortest_path(g, src, targets[i < count ? i : i - count - 1], want, sizeof want);
+        REQUIRE(strcmp(got, want) == 0);
+    }
+    REQUIRE(!fgets(got, sizeof got, tmp));
+    fclose(tmp);
+
+    /* Hits return the cached tree; a third source evicts the LRU one */
+    const ShortestPathTree *a = sp_tree_cache_get(cache, "A");
+    REQUIRE(a && a == sp_tree_cache_get(cache, "A"));
+    const ShortestPathTree *b = sp_tree_cache_get(cache, "B");
+    REQUIRE(b && b != a && sp_tree_cache_get(cache, "A") == a);
+    const ShortestPathTree *c = sp_tree_cache_get(cache, "C");
+    REQUIRE(c == b && c->source == sp_tree_index_of(c, "C"));   /* B was LRU */
+    REQUIRE(sp_tree_cache_get(cache, "A") == a && a->source == 0);
+    REQUIRE(sp_tree_cache_get(cache, "Z") == NULL);
+
+    sp_tree_cache_destroy(cache);
+    graph_csr_destroy(csr);
+    graph_destroy(g);
+}
+
+/* Half the edges share a few weights: many equal-cost paths */
+static int weight_mixed(int i, unsigned r)
+{
+    return (i % 2) ? weight_upto100(i, r) : weight_upto3(i, r);
+}
+
+/* Delta-stepping builds the heap engine's tree for any width and thread count */
+static void test_delta_matches_heap(void)
+{
+    enum { N = 4000, E = 16000 };   /* Frontiers large enough to use the pool */
+    Graph *g = make_random_graph(N, E, 777, weight_mixed);
+
+    GraphCSR *csr = graph_freeze(g);
+    const int deltas[] = { 1, 5, 0, 100 };
+    const int threads[] = { 1, 3, 8 };
+    for (int src = 0; src < N; src += 1333) {
+        ShortestPathTree h;
+        REQUIRE(sp_dijkstra_csr(csr, rg_names[src], &h));
+        for (size_t d = 0; d < sizeof deltas / sizeof deltas[0]; ++d) {
+            for (size_t t = 0; t < sizeof threads / sizeof threads[0]; ++t) {
+                ShortestPathTree p;
+                REQUIRE(sp_delta_stepping_csr(csr, rg_names[src], deltas[d], threads[t], &p));
+                REQUIRE(p.n == h.n && p.source == h.source);
+                REQUIRE(memcmp(p.dist, h.dist, h.n * sizeof(int)) == 0);
+                REQUIRE(memcmp(p.parent, h.parent, h.n * sizeof(int)) == 0);
+                sp_tree_free(&p);
+            }
+        }
+        sp_tree_free(&h);
+    }
+
+    ShortestPathTree p;
+    REQUIRE(!sp_delta_stepping_csr(csr, "zzz", 0, 2, &p));
+    SPEngine e;
+    REQUIRE(sp_engine_from_name("delta", &e) && e == SP_ENGINE_DELTA);
+    REQUIRE(sp_tree_csr(csr, rg_names[1], SP_ENGINE_DELTA, &p));
+    sp_tree_free(&p);
+
+    graph_csr_destroy(csr);
+    graph_destroy(g);
+}
+
+/* ---------- driver ---------- */
+int main(void)
+{
+    puts("Running shortest_Path unit tests…");
+
+    test_tree_distances();
+    test_print_format();
+    test_graph_engine_matches_csr();
+    test_dial_matches_heap();
+    test_bidirectional_matches_heap();
+    test_alt_matches_heap();
+    test_apsp_matches_heap();
+    test_batch_matches_single();
+    test_delta_matches_heap();
+
+    puts("✅  All shortest_Path tests PASSED");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,116 @@
+/* =======================================================================
+ *  test_worker_pool.c  –  Unit tests for worker_pool.[ch]
+ *  -----------------------------------------------------------------------
+ *  Compile (from project root):
+ *
+ *      gcc -Wall -Wextra -pedantic -std=c11 -pthread \
+ *          test/test_worker_pool.c \
+ *          src/worker_pool/worker_pool.c \
+ *          -o test_worker_pool
+ *
+ *  Run:
+ *      ./test_worker_pool
+ *
+ *  PASS ⇒ program exits 0 and prints a short summary.
+ * =======================================================================
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+
+#include "worker_pool.h"
+
+/* ---------- tiny assertion wrapper ---------- */
+static void fail(const char *msg)
+{
+    fprintf(stderr, "❌  %s\n", msg);
+    exit(EXIT_FAILURE);
+}
+#define REQUIRE(expr)  do { if(!(expr)) fail(#expr); } while(0)
+
+/* ---------- fixture: every slice adds its job to hits[lo, hi) ---------- */
+enum { ITEMS = 10000 };
+
+typedef struct Counts {
+    atomic_int hits[ITEMS];
+    atomic_int calls;
+    atomic_int whole;        /* Calls with parts == 1 */
+} Counts;
+
+static void count_slice(void *ctx, int job, int t, int parts)
+{
+    Counts *c = ctx;
+    size_t lo = (size_t)ITEMS * (size_t)t / (size_t)parts;
+    size_t hi = (size_t)ITEMS * (size_t)(t + 1) / (size_t)parts;
+    for (size_t i = lo; i < hi; ++i) atomic_fetch_add(&c->hits[i], job);
+    atomic_fetch_add(&c->calls, 1);
+    if (parts == 1) atomic_fetch_add(&c->whole, 1);
+}
+
+static void reset(Counts *c)
+{
+    for (int i = 0; i < ITEMS; ++i) atomic_init(&c->hits[i], 0);
+    atomic_init(&c->calls, 0);
+    atomic_init(&c->whole, 0);
+}
+
+/* ---------- thread-count heuristic ---------- */
+static void test_thread_count(void)
+{
+    REQUIRE( worker_pool_threads(3, 0, 1u << 15) == 3 );
+    REQUIRE( worker_pool_threads(1000, 0, 1u << 15) == WORKER_POOL_MAX_THREADS );
+    REQUIRE( worker_pool_threads(0, 100, 1u << 15) == 1 );     /* Too little work */
+    REQUIRE( worker_pool_threads(-1, 0, 0) == 1 );
+    int dflt = worker_pool_threads(0, (size_t)1 << 40, 1u << 15);
+    REQUIRE( dflt >= 1 && dflt <= WORKER_POOL_MAX_THREADS );
+}
+
+/* ---------- every phase covers every item once, on any thread count ---------- */
+static void test_phases_cover_all(void)
+{
+    static Counts c;
+    const int threads[] = { 1, 2, 3, 8, WORKER_POOL_MAX_THREADS };
+    for (size_t k = 0; k < sizeof threads / sizeof threads[0]; ++k) {
+        reset(&c);
+        WorkerPool *pool = worker_pool_create(threads[k], count_slice, &c);
+        REQUIRE( pool != NULL );
+
+        int expect = 0;
+        for (int phase = 1; phase <= 200; ++phase) {
+            worker_pool_run(pool, phase, ITEMS, 0);
+            expect += phase;
+        }
+        for (int i = 0; i < ITEMS; ++i) REQUIRE( atomic_load(&c.hits[i]) == expect );
+        REQUIRE( atomic_load(&c.calls) == 200 * threads[k] );
+        REQUIRE( atomic_load(&c.whole) == (threads[k] == 1 ? 200 : 0) );
+        worker_pool_destroy(pool);
+    }
+}
+
+/* ---------- short phases run inline as a single slice ---------- */
+static void test_short_phase_inline(void)
+{
+    static Counts c;
+    reset(&c);
+    WorkerPool *pool = worker_pool_create(4, count_slice, &c);
+    REQUIRE( pool != NULL );
+    worker_pool_run(pool, 1, 10, 512);
+    REQUIRE( atomic_load(&c.calls) == 1 && atomic_load(&c.whole) == 1 );
+    for (int i = 0; i < ITEMS; ++i) REQUIRE( atomic_load(&c.hits[i]) == 1 );
+    worker_pool_destroy(pool);
+    worker_pool_destroy(NULL);
+}
+
+/* ---------- driver ---------- */
+int main(void)
+{
+    puts("Running worker pool unit tests…");
+
+    test_thread_count();
+    test_phases_cover_all();
+    test_short_phase_inline();
+
+    puts("✅  All worker pool tests PASSED");
+    return EXIT_SUCCESS;
+}